@@ -1,3 +1,4 @@
+#include <stddef.h>
 #include "font.h"
 #include "font/console_font_5x8.h"
 #include "font/AIXOID9.h"
@@ -7,6 +8,8 @@
 #include "font/MEDIEVAL.h"
 #include "font/SCRAWL2.h"
 #include "font/SCRIPT2.h"
+#include "font/DEJAVU_F16.h"
+#include "font/DEJAVU_AA16.h"
 
 const FONT_T console_font_5x8 = { 5, 8, 8, 0, console_font_5x8_glyphs };
 const FONT_T AIXOID9_F16 = { 8, 16, 16, 0, AIXOID9_F16_glyphs };
@@ -16,6 +19,8 @@ const FONT_T HOLLOW_F16 = { 8, 16, 16, 0, HOLLOW_F16_glyphs };
 const FONT_T MEDIEVAL_F16 = { 8, 16, 16, 0, MEDIEVAL_F16_glyphs };
 const FONT_T SCRAWL2_F16 = { 8, 16, 16, 0, SCRAWL2_F16_glyphs };
 const FONT_T SCRIPT2_F14 = { 8, 14, 14, 0, SCRIPT2_F14_glyphs };
+const FONT_T DEJAVU_F16 = { 14, 16, 0, 32, DEJAVU_F16_glyphs, DEJAVU_F16_glyph_info, 95, DEJAVU_F16_kern, 57, 1 };
+const FONT_T DEJAVU_AA16 = { 14, 16, 0, 32, DEJAVU_AA16_glyphs, DEJAVU_AA16_glyph_info, 95, DEJAVU_AA16_kern, 141, 4 };
 
 const FONT_T* font[MAX_FONT] = {
     &console_font_5x8,
@@ -25,6 +30,53 @@ const FONT_T* font[MAX_FONT] = {
     &HOLLOW_F16,
     &MEDIEVAL_F16,
     &SCRAWL2_F16,
-    &SCRIPT2_F14
+    &SCRIPT2_F14,
+    &DEJAVU_F16,
+    &DEJAVU_AA16
 };
 
+
+// Glyph of a character in a proportional font, NULL if the font doesn't have it
+const FONT_GLYPH_T* font_glyph(const FONT_T* f, uint8_t c)
+{
+    if (c < f->start || c - f->start >= f->num_glyphs) return NULL;
+    return &f->glyph_info[c - f->start];
+}
+
+int8_t font_kern(const FONT_T* f, uint8_t left, uint8_t right)
+{
+    int32_t lo = 0;
+    int32_t hi = f->num_kern - 1;
+    int32_t mid, cmp;
+
+    while (lo <= hi) {
+        mid = (lo + hi) / 2;
+        cmp = ((f->kern[mid].left << 8) | f->kern[mid].right) - ((left << 8) | right);
+        if (cmp == 0) return f->kern[mid].offset;
+        if (cmp < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    return 0;
+}
+
+// Pixels a line of text takes, up to the last column of its last glyph
+uint32_t font_text_width(const FONT_T* f, const char* text, uint32_t len)
+{
+    const FONT_GLYPH_T* glyph;
+    int32_t pen = 0;
+    int32_t width = 0;
+    uint32_t i;
+
+    if (!f->glyph_info) return len * f->width;
+    for (i = 0; i < len; i++) {
+        glyph = font_glyph(f, text[i]);
+        if (!glyph) continue;
+        if (i > 0) pen += font_kern(f, text[i - 1], text[i]);
+        if (pen + glyph->bearing + glyph->width > width) width = pen + glyph->bearing + glyph->width;
+        pen += glyph->advance;
+    }
+    return (pen > width) ? pen : width;
+}
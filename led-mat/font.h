@@ -5,17 +5,43 @@
 
 #include <stdint.h>
 
+// A glyph of a proportional font
+// Its rows are (width * bpp + 7) / 8 bytes, MSB first, and there are as many as the font is high
+typedef struct FONT_GLYPH_T_ {
+    uint32_t offset;  // in glyphs
+    uint8_t width;  // in pixels
+    uint8_t advance;  // to the start of the next character
+    int8_t bearing;  // from the start of this character to the first column
+} FONT_GLYPH_T;
+
+// Extra space between a pair of characters, usually negative
+typedef struct FONT_KERN_T_ {
+    uint8_t left;
+    uint8_t right;
+    int8_t offset;
+} FONT_KERN_T;
+
+// Fixed cell fonts have a byte per glyph row, so they are at most 8 wide
+// Proportional fonts have glyph_info, and width is their widest advance
 typedef struct FONT_T_ {
     uint8_t width;
     uint8_t height;
     uint8_t stride;
     uint8_t start;
     const uint8_t* glyphs;
+    const FONT_GLYPH_T* glyph_info;  // for characters start to start + num_glyphs - 1
+    uint16_t num_glyphs;
+    const FONT_KERN_T* kern;  // sorted by left, then right character
+    uint16_t num_kern;
+    uint8_t bpp;  // proportional fonts can have 2 or 4 bits of coverage per pixel, 0 is 1
 } FONT_T;
 
 #define NO_BACKGROUND 0x0020
 
-#define MAX_FONT 8
+#define MAX_FONT 10
+
+// Font id for an image box that shows RGB565 pixels instead of text
+#define FONT_ID_IMAGE 0xff
 
 #define FONT_ID_CONSOLE_5X8 0
 #define FONT_ID_AIXOID9_F16 1
@@ -25,6 +51,8 @@ typedef struct FONT_T_ {
 #define FONT_ID_MEDIEVAL_F16 5
 #define FONT_ID_SCRAWL2_F16 6
 #define FONT_ID_SCRIPT2_F14 7
+#define FONT_ID_DEJAVU_F16 8  // proportional, with kerning
+#define FONT_ID_DEJAVU_AA16 9  // proportional, with kerning, 4 bits of coverage
 
 extern const FONT_T* font[MAX_FONT];
 
@@ -36,5 +64,12 @@ extern const FONT_T HOLLOW_F16;
 extern const FONT_T MEDIEVAL_F16;
 extern const FONT_T SCRAWL2_F16;
 extern const FONT_T SCRIPT2_F14;
+extern const FONT_T DEJAVU_F16;
+extern const FONT_T DEJAVU_AA16;
+
+// Font functions
+const FONT_GLYPH_T* font_glyph(const FONT_T* f, uint8_t c);
+int8_t font_kern(const FONT_T* f, uint8_t left, uint8_t right);
+uint32_t font_text_width(const FONT_T* f, const char* text, uint32_t len);
 
 #endif
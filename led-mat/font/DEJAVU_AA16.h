@@ -0,0 +1,1870 @@
+// DEJAVU_AA16, converted from DejaVuSans56.bdf by led-bdf
+// DejaVu Sans Book drawn at 56 pixels to the em, scaled down 4 times to 4 bits of coverage, with the pairs of its kern table
+// Copyright (c) 2003 by Bitstream, Inc. All Rights Reserved. DejaVu changes are in public domain.
+// Bitstream Vera is a trademark of Bitstream, Inc. See DEJAVU-LICENSE.txt for the license.
+
+#ifndef __DEJAVU_AA16_H
+#define __DEJAVU_AA16_H
+
+static const uint8_t DEJAVU_AA16_glyphs[] = {
+    // code=32
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // code=33
+    0x00,
+    0x42,
+    0xf8,
+    0xf8,
+    0xf8,
+    0xf8,
+    0xf8,
+    0xf8,
+    0x95,
+    0x00,
+    0xb6,
+    0xf8,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // code=34
+    0x00, 0x00, 0x00,
+    0x32, 0x04, 0x10,
+    0xb8, 0x0f, 0x40,
+    0xb8, 0x0f, 0x40,
+    0xb8, 0x0f, 0x40,
+    0x64, 0x08, 0x20,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // code=35
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0xa0, 0x1b, 0x00,
+    0x00, 0x06, 0xa0, 0x5b, 0x00,
+    0x00, 0x09, 0x70, 0x88, 0x00,
+    0x4f, 0xff, 0xff, 0xff, 0xf8,
+    0x00, 0x3e, 0x02, 0xf0, 0x00,
+    0x00, 0x7a, 0x06, 0xb0, 0x00,
+    0xbb, 0xdd, 0xbd, 0xdb, 0x80,
+    0x44, 0xf6, 0x4e, 0x74, 0x30,
+    0x03, 0xe0, 0x2f, 0x00, 0x00,
+    0x07, 0x90, 0x6b, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // code=36
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0x00, 0x00,
+    0x00, 0x0b, 0x00, 0x00,
+    0x2a, 0xff, 0xfb, 0x20,
+    0xb9, 0x1b, 0x16, 0x30,
+    0xf5, 0x0b, 0x00, 0x00,
+    0xbd, 0x8c, 0x10, 0x00,
+    0x18, 0xcf, 0xf9, 0x10,
+    0x00, 0x0b, 0x4d, 0x90,
+    0x00, 0x0b, 0x08, 0xb0,
+    0xa5, 0x0b, 0x3d, 0x80,
+    0x7c, 0xff, 0xd8, 0x00,
+    0x00, 0x0b, 0x00, 0x00,
+    0x00, 0x0b, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // code=37
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x78, 0x20, 0x00, 0x07, 0x20, 0x00,
+    0x0c, 0x75, 0xd1, 0x00, 0x6b, 0x00, 0x00,
+    0x3c, 0x00, 0x87, 0x01, 0xe3, 0x00, 0x00,
+    0x4b, 0x00, 0x88, 0x08, 0x90, 0x00, 0x00,
+    0x1e, 0x10, 0xb5, 0x2e, 0x10, 0x00, 0x00,
+    0x06, 0xcc, 0x80, 0xb7, 0x03, 0x40, 0x00,
+    0x00, 0x00, 0x05, 0xc0, 0x9a, 0x8c, 0x00,
+    0x00, 0x00, 0x1d, 0x42, 0xd0, 0x09, 0x60,
+    0x00, 0x00, 0x8a, 0x04, 0xb0, 0x08, 0x80,
+    0x00, 0x02, 0xd2, 0x02, 0xd0, 0x09, 0x60,
+    0x00, 0x0a, 0x80, 0x00, 0x9a, 0x8c, 0x10,
+    0x00, 0x04, 0x10, 0x00, 0x03, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // code=38
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x88, 0x30, 0x00, 0x00,
+    0x00, 0x8e, 0x88, 0xe0, 0x00, 0x00,
+    0x00, 0xe5, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0xf6, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xae, 0x30, 0x00, 0x00, 0x00,
+    0x05, 0xea, 0xe2, 0x00, 0x46, 0x00,
+    0x0e, 0x50, 0xbc, 0x10, 0x88, 0x00,
+    0x4f, 0x00, 0x1c, 0xc1, 0xd4, 0x00,
+    0x3f, 0x10, 0x01, 0xce, 0xb0, 0x00,
+    0x0c, 0x91, 0x00, 0x5f, 0xa0, 0x00,
+    0x02, 0xbe, 0xbd, 0xd6, 0xc9, 0x00,
+    0x00, 0x03, 0x42, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // code=39
+    0x00,
+    0x32,
+    0xb8,
+    0xb8,
+    0xb8,
+    0x64,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // code=40
+    0x00, 0x00,
+    0x00, 0xa3,
+    0x08, 0xb0,
+    0x0d, 0x50,
+    0x5e, 0x00,
+    0x8b, 0x00,
+    0xb8, 0x00,
+    0xb8, 0x00,
+    0xb8, 0x00,
+    0x8b, 0x00,
+    0x5e, 0x00,
+    0x0d, 0x50,
+    0x06, 0xb0,
+    0x00, 0xa3,
+    0x00, 0x00,
+    0x00, 0x00,
+    // code=41
+    0x00, 0x00,
+    0x95, 0x00,
+    0x4d, 0x00,
+    0x0c, 0x60,
+    0x07, 0xc0,
+    0x04, 0xf0,
+    0x00, 0xf4,
+    0x00, 0xf4,
+    0x00, 0xf4,
+    0x04, 0xf0,
+    0x07, 0xc0,
+    0x0c, 0x60,
+    0x4d, 0x00,
+    0x95, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // code=42
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0x00, 0x00,
+    0x10, 0x0b, 0x00, 0x10,
+    0x7b, 0x3b, 0x5c, 0x40,
+    0x02, 0xbf, 0x81, 0x00,
+    0x19, 0xad, 0xb8, 0x00,
+    0x64, 0x0b, 0x06, 0x40,
+    0x00, 0x0b, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // code=43
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x86, 0x00, 0x00,
+    0x00, 0x00, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0xb8, 0x00, 0x00,
+    0x8f, 0xff, 0xff, 0xff, 0xf4,
+    0x24, 0x44, 0xc9, 0x44, 0x41,
+    0x00, 0x00, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // code=44
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x3b,
+    0x4e,
+    0x89,
+    0x63,
+    0x00,
+    0x00,
+    // code=45
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x28, 0x88, 0x40,
+    0x3b, 0xbb, 0x60,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // code=46
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x3b,
+    0x4f,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // code=47
+    0x00, 0x00, 0x00,
+    0x00, 0x02, 0x30,
+    0x00, 0x0c, 0x80,
+    0x00, 0x1f, 0x30,
+    0x00, 0x6e, 0x00,
+    0x00, 0xa9, 0x00,
+    0x00, 0xe5, 0x00,
+    0x05, 0xf1, 0x00,
+    0x08, 0xa0, 0x00,
+    0x0d, 0x70, 0x00,
+    0x3f, 0x20, 0x00,
+    0x7d, 0x00, 0x00,
+    0xc8, 0x00, 0x00,
+    0x41, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // code=48
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x68, 0x60, 0x00,
+    0x0c, 0xb8, 0xcc, 0x00,
+    0x7d, 0x00, 0x1d, 0x60,
+    0xb8, 0x00, 0x08, 0xb0,
+    0xf4, 0x00, 0x04, 0xf0,
+    0xf4, 0x00, 0x04, 0xf0,
+    0xf4, 0x00, 0x04, 0xf0,
+    0xe5, 0x00, 0x05, 0xe0,
+    0xa8, 0x00, 0x08, 0xa0,
+    0x5e, 0x10, 0x3e, 0x40,
+    0x08, 0xeb, 0xe8, 0x00,
+    0x00, 0x24, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // code=49
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x34, 0x10, 0x00,
+    0x6f, 0xdf, 0x40, 0x00,
+    0x21, 0x0f, 0x40, 0x00,
+    0x00, 0x0f, 0x40, 0x00,
+    0x00, 0x0f, 0x40, 0x00,
+    0x00, 0x0f, 0x40, 0x00,
+    0x00, 0x0f, 0x40, 0x00,
+    0x00, 0x0f, 0x40, 0x00,
+    0x00, 0x0f, 0x40, 0x00,
+    0x00, 0x0f, 0x40, 0x00,
+    0x4f, 0xff, 0xff, 0x80,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // code=50
+    0x00, 0x00, 0x00, 0x00,
+    0x04, 0x88, 0x30, 0x00,
+    0xed, 0x88, 0xd9, 0x00,
+    0x70, 0x00, 0x1e, 0x60,
+    0x00, 0x00, 0x0b, 0x80,
+    0x00, 0x00, 0x1e, 0x60,
+    0x00, 0x00, 0xac, 0x00,
+    0x00, 0x09, 0xe3, 0x00,
+    0x00, 0x9e, 0x30, 0x00,
+    0x09, 0xe3, 0x00, 0x00,
+    0x9e, 0x30, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0x80,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // code=51
+    0x00, 0x00, 0x00, 0x00,
+    0x15, 0x88, 0x50, 0x00,
+    0xbc, 0x88, 0xdc, 0x10,
+    0x10, 0x00, 0x1d, 0x70,
+    0x00, 0x00, 0x0b, 0x80,
+    0x00, 0x00, 0x7e, 0x20,
+    0x04, 0xff, 0xf6, 0x00,
+    0x00, 0x00, 0x6e, 0x50,
+    0x00, 0x00, 0x08, 0xa0,
+    0x00, 0x00, 0x08, 0xb0,
+    0x40, 0x00, 0x2e, 0x60,
+    0xdd, 0xbb, 0xf8, 0x00,
+    0x02, 0x44, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // code=52
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x30, 0x00,
+    0x00, 0x00, 0x8f, 0xb0, 0x00,
+    0x00, 0x03, 0xe8, 0xb0, 0x00,
+    0x00, 0x0c, 0x68, 0xb0, 0x00,
+    0x00, 0x8b, 0x08, 0xb0, 0x00,
+    0x03, 0xe2, 0x08, 0xb0, 0x00,
+    0x0c, 0x70, 0x08, 0xb0, 0x00,
+    0x4e, 0x88, 0x8b, 0xd8, 0x20,
+    0x28, 0x88, 0x8b, 0xd8, 0x20,
+    0x00, 0x00, 0x08, 0xb0, 0x00,
+    0x00, 0x00, 0x08, 0xb0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // code=53
+    0x00, 0x00, 0x00, 0x00,
+    0x24, 0x44, 0x43, 0x00,
+    0x8e, 0xbb, 0xb8, 0x00,
+    0x8b, 0x00, 0x00, 0x00,
+    0x8b, 0x00, 0x00, 0x00,
+    0x8d, 0xbb, 0x71, 0x00,
+    0x56, 0x46, 0xcc, 0x00,
+    0x00, 0x00, 0x1e, 0x50,
+    0x00, 0x00, 0x0b, 0x80,
+    0x00, 0x00, 0x0d, 0x70,
+    0x70, 0x00, 0x6f, 0x20,
+    0xee, 0xbd, 0xe5, 0x00,
+    0x03, 0x43, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // code=54
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x28, 0x85, 0x00,
+    0x06, 0xe8, 0x8d, 0x40,
+    0x4e, 0x10, 0x00, 0x10,
+    0xa8, 0x00, 0x00, 0x00,
+    0xe7, 0xcf, 0xe8, 0x00,
+    0xff, 0x80, 0x2d, 0x80,
+    0xfd, 0x00, 0x06, 0xd0,
+    0xeb, 0x00, 0x04, 0xf0,
+    0xac, 0x00, 0x05, 0xe0,
+    0x4f, 0x40, 0x0b, 0x90,
+    0x08, 0xfb, 0xdb, 0x10,
+    0x00, 0x24, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // code=55
+    0x00, 0x00, 0x00, 0x00,
+    0x44, 0x44, 0x44, 0x20,
+    0xbb, 0xbb, 0xbf, 0x70,
+    0x00, 0x00, 0x5f, 0x10,
+    0x00, 0x00, 0x9a, 0x00,
+    0x00, 0x01, 0xf5, 0x00,
+    0x00, 0x06, 0xe0, 0x00,
+    0x00, 0x0c, 0x80, 0x00,
+    0x00, 0x3f, 0x20, 0x00,
+    0x00, 0x8c, 0x00, 0x00,
+    0x00, 0xe6, 0x00, 0x00,
+    0x05, 0xf1, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // code=56
+    0x00, 0x00, 0x00, 0x00,
+    0x01, 0x78, 0x71, 0x00,
+    0x3e, 0xa8, 0xbe, 0x30,
+    0xa9, 0x00, 0x0a, 0xa0,
+    0xb8, 0x00, 0x08, 0xb0,
+    0x5d, 0x40, 0x4e, 0x50,
+    0x09, 0xff, 0xf9, 0x00,
+    0x8c, 0x30, 0x3c, 0x80,
+    0xe5, 0x00, 0x05, 0xe0,
+    0xf4, 0x00, 0x04, 0xf0,
+    0xba, 0x00, 0x0a, 0xb0,
+    0x3c, 0xeb, 0xec, 0x30,
+    0x00, 0x34, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // code=57
+    0x00, 0x00, 0x00, 0x00,
+    0x01, 0x68, 0x50, 0x00,
+    0x3e, 0xb8, 0xdb, 0x00,
+    0xaa, 0x00, 0x1d, 0x60,
+    0xf4, 0x00, 0x08, 0xb0,
+    0xf4, 0x00, 0x08, 0xe0,
+    0xc8, 0x00, 0x0c, 0xf0,
+    0x5f, 0x84, 0xae, 0xf0,
+    0x04, 0xab, 0x87, 0xd0,
+    0x00, 0x00, 0x09, 0x80,
+    0x22, 0x00, 0x4e, 0x20,
+    0x3f, 0xbc, 0xd3, 0x00,
+    0x01, 0x44, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // code=58
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x14, 0x10,
+    0x4f, 0x40,
+    0x28, 0x20,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x3b, 0x30,
+    0x4f, 0x40,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // code=59
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x14,
+    0x4f,
+    0x28,
+    0x00,
+    0x00,
+    0x00,
+    0x3b,
+    0x4e,
+    0x89,
+    0x63,
+    0x00,
+    0x00,
+    // code=60
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x49, 0xe4,
+    0x00, 0x02, 0x8d, 0xfa, 0x61,
+    0x17, 0xcf, 0xc7, 0x20, 0x00,
+    0x8f, 0xf6, 0x00, 0x00, 0x00,
+    0x17, 0xcf, 0xc7, 0x20, 0x00,
+    0x00, 0x02, 0x8d, 0xfa, 0x61,
+    0x00, 0x00, 0x00, 0x49, 0xe4,
+    0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // code=61
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x88, 0x88, 0x88, 0x82,
+    0x6b, 0xbb, 0xbb, 0xbb, 0xb3,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x88, 0x88, 0x88, 0x82,
+    0x6b, 0xbb, 0xbb, 0xbb, 0xb3,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // code=62
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00,
+    0x8d, 0x82, 0x00, 0x00, 0x00,
+    0x27, 0xcf, 0xc7, 0x10, 0x00,
+    0x00, 0x03, 0x8d, 0xfa, 0x60,
+    0x00, 0x00, 0x00, 0x8f, 0xf4,
+    0x00, 0x03, 0x8d, 0xfa, 0x60,
+    0x27, 0xcf, 0xc7, 0x10, 0x00,
+    0x8d, 0x82, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // code=63
+    0x00, 0x00, 0x00,
+    0x16, 0x87, 0x10,
+    0xea, 0x8b, 0xe2,
+    0x30, 0x00, 0xc8,
+    0x00, 0x00, 0xd7,
+    0x00, 0x1a, 0xc1,
+    0x00, 0xbc, 0x10,
+    0x03, 0xf2, 0x00,
+    0x04, 0xf0, 0x00,
+    0x01, 0x40, 0x00,
+    0x03, 0xb3, 0x00,
+    0x04, 0xf4, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // code=64
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x8b, 0xb9, 0x60, 0x00,
+    0x00, 0x8e, 0x84, 0x46, 0xbc, 0x30,
+    0x09, 0xa1, 0x00, 0x00, 0x06, 0xe1,
+    0x4d, 0x10, 0x28, 0x61, 0x30, 0x89,
+    0xa6, 0x04, 0xe8, 0x8e, 0xb0, 0x2d,
+    0xf1, 0x0a, 0x70, 0x07, 0xb0, 0x0f,
+    0xf0, 0x0b, 0x40, 0x04, 0xb0, 0x2d,
+    0xe2, 0x09, 0x80, 0x08, 0xb1, 0xa8,
+    0x96, 0x02, 0xdc, 0xcb, 0xed, 0x80,
+    0x4e, 0x10, 0x04, 0x21, 0x40, 0x00,
+    0x06, 0xc3, 0x00, 0x00, 0x46, 0x00,
+    0x00, 0x6e, 0xb8, 0x8c, 0xd5, 0x00,
+    0x00, 0x00, 0x58, 0x85, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // code=65
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x42, 0x00, 0x00,
+    0x00, 0x07, 0xfa, 0x00, 0x00,
+    0x00, 0x0c, 0xcf, 0x10, 0x00,
+    0x00, 0x3f, 0x2d, 0x70, 0x00,
+    0x00, 0x8c, 0x08, 0xc0, 0x00,
+    0x00, 0xe6, 0x02, 0xf3, 0x00,
+    0x05, 0xf1, 0x00, 0xc8, 0x00,
+    0x0a, 0xeb, 0xbb, 0xde, 0x00,
+    0x1f, 0x74, 0x44, 0x4f, 0x50,
+    0x7d, 0x00, 0x00, 0x09, 0xa0,
+    0xc8, 0x00, 0x00, 0x05, 0xf1,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // code=66
+    0x00, 0x00, 0x00, 0x00,
+    0x34, 0x44, 0x40, 0x00,
+    0xbd, 0xbb, 0xce, 0x40,
+    0xb8, 0x00, 0x08, 0xd0,
+    0xb8, 0x00, 0x04, 0xf0,
+    0xb8, 0x00, 0x1a, 0xb0,
+    0xbf, 0xff, 0xfe, 0x30,
+    0xb8, 0x00, 0x07, 0xe1,
+    0xb8, 0x00, 0x00, 0xc7,
+    0xb8, 0x00, 0x00, 0xc8,
+    0xb8, 0x00, 0x07, 0xf2,
+    0xbf, 0xff, 0xfc, 0x50,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // code=67
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x68, 0x83, 0x00,
+    0x00, 0x6f, 0xa8, 0x8d, 0xc0,
+    0x05, 0xe3, 0x00, 0x00, 0x90,
+    0x0d, 0x60, 0x00, 0x00, 0x00,
+    0x2f, 0x20, 0x00, 0x00, 0x00,
+    0x4f, 0x00, 0x00, 0x00, 0x00,
+    0x4f, 0x00, 0x00, 0x00, 0x00,
+    0x1f, 0x30, 0x00, 0x00, 0x00,
+    0x0b, 0x80, 0x00, 0x00, 0x00,
+    0x03, 0xe7, 0x00, 0x02, 0xc0,
+    0x00, 0x3d, 0xeb, 0xce, 0x80,
+    0x00, 0x00, 0x24, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // code=68
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x34, 0x44, 0x30, 0x00, 0x00,
+    0xbd, 0xbb, 0xce, 0x91, 0x00,
+    0xb8, 0x00, 0x02, 0xcc, 0x00,
+    0xb8, 0x00, 0x00, 0x1e, 0x60,
+    0xb8, 0x00, 0x00, 0x09, 0x90,
+    0xb8, 0x00, 0x00, 0x08, 0xb0,
+    0xb8, 0x00, 0x00, 0x08, 0xb0,
+    0xb8, 0x00, 0x00, 0x0a, 0x80,
+    0xb8, 0x00, 0x00, 0x3f, 0x40,
+    0xb8, 0x00, 0x16, 0xe9, 0x00,
+    0xbf, 0xff, 0xea, 0x60, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // code=69
+    0x00, 0x00, 0x00, 0x00,
+    0x34, 0x44, 0x44, 0x20,
+    0xbd, 0xbb, 0xbb, 0x60,
+    0xb8, 0x00, 0x00, 0x00,
+    0xb8, 0x00, 0x00, 0x00,
+    0xb8, 0x00, 0x00, 0x00,
+    0xbf, 0xff, 0xff, 0x80,
+    0xb8, 0x00, 0x00, 0x00,
+    0xb8, 0x00, 0x00, 0x00,
+    0xb8, 0x00, 0x00, 0x00,
+    0xb8, 0x00, 0x00, 0x00,
+    0xbf, 0xff, 0xff, 0xb0,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // code=70
+    0x00, 0x00, 0x00,
+    0x34, 0x44, 0x44,
+    0xbd, 0xbb, 0xbb,
+    0xb8, 0x00, 0x00,
+    0xb8, 0x00, 0x00,
+    0xb8, 0x00, 0x00,
+    0xbf, 0xff, 0xf8,
+    0xb8, 0x00, 0x00,
+    0xb8, 0x00, 0x00,
+    0xb8, 0x00, 0x00,
+    0xb8, 0x00, 0x00,
+    0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // code=71
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x68, 0x85, 0x10,
+    0x00, 0x6e, 0xa8, 0x8c, 0xe5,
+    0x05, 0xe3, 0x00, 0x00, 0x47,
+    0x0d, 0x60, 0x00, 0x00, 0x00,
+    0x2f, 0x20, 0x00, 0x00, 0x00,
+    0x4f, 0x00, 0x00, 0x34, 0x43,
+    0x4f, 0x00, 0x00, 0x8b, 0xdb,
+    0x1f, 0x30, 0x00, 0x00, 0x8b,
+    0x0b, 0x80, 0x00, 0x00, 0x8b,
+    0x03, 0xe7, 0x00, 0x00, 0x8b,
+    0x00, 0x3b, 0xeb, 0xbe, 0xd5,
+    0x00, 0x00, 0x24, 0x42, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // code=72
+    0x00, 0x00, 0x00, 0x00,
+    0x32, 0x00, 0x00, 0x14,
+    0xb8, 0x00, 0x00, 0x4f,
+    0xb8, 0x00, 0x00, 0x4f,
+    0xb8, 0x00, 0x00, 0x4f,
+    0xb8, 0x00, 0x00, 0x4f,
+    0xbf, 0xff, 0xff, 0xff,
+    0xb8, 0x00, 0x00, 0x4f,
+    0xb8, 0x00, 0x00, 0x4f,
+    0xb8, 0x00, 0x00, 0x4f,
+    0xb8, 0x00, 0x00, 0x4f,
+    0xb8, 0x00, 0x00, 0x4f,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // code=73
+    0x00,
+    0x32,
+    0xb8,
+    0xb8,
+    0xb8,
+    0xb8,
+    0xb8,
+    0xb8,
+    0xb8,
+    0xb8,
+    0xb8,
+    0xb8,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // code=74
+    0x00, 0x00,
+    0x00, 0x32,
+    0x00, 0xb8,
+    0x00, 0xb8,
+    0x00, 0xb8,
+    0x00, 0xb8,
+    0x00, 0xb8,
+    0x00, 0xb8,
+    0x00, 0xb8,
+    0x00, 0xb8,
+    0x00, 0xb8,
+    0x00, 0xb8,
+    0x00, 0xc7,
+    0x37, 0xf2,
+    0x8a, 0x40,
+    0x00, 0x00,
+    // code=75
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x32, 0x00, 0x00, 0x43, 0x00,
+    0xb8, 0x00, 0x09, 0xe3, 0x00,
+    0xb8, 0x01, 0xae, 0x30, 0x00,
+    0xb8, 0x1c, 0xd3, 0x00, 0x00,
+    0xb8, 0xcc, 0x10, 0x00, 0x00,
+    0xbf, 0xf2, 0x00, 0x00, 0x00,
+    0xb8, 0xcc, 0x10, 0x00, 0x00,
+    0xb8, 0x1c, 0xc1, 0x00, 0x00,
+    0xb8, 0x01, 0xcc, 0x10, 0x00,
+    0xb8, 0x00, 0x3e, 0xc1, 0x00,
+    0xb8, 0x00, 0x03, 0xec, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // code=76
+    0x00, 0x00, 0x00, 0x00,
+    0x32, 0x00, 0x00, 0x00,
+    0xb8, 0x00, 0x00, 0x00,
+    0xb8, 0x00, 0x00, 0x00,
+    0xb8, 0x00, 0x00, 0x00,
+    0xb8, 0x00, 0x00, 0x00,
+    0xb8, 0x00, 0x00, 0x00,
+    0xb8, 0x00, 0x00, 0x00,
+    0xb8, 0x00, 0x00, 0x00,
+    0xb8, 0x00, 0x00, 0x00,
+    0xb8, 0x00, 0x00, 0x00,
+    0xbf, 0xff, 0xff, 0x80,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // code=77
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x34, 0x20, 0x00, 0x03, 0x42,
+    0xbf, 0x90, 0x00, 0x0d, 0xf8,
+    0xbc, 0xf1, 0x00, 0x5f, 0xc8,
+    0xb8, 0xe6, 0x00, 0x9a, 0xb8,
+    0xb8, 0x8c, 0x01, 0xf5, 0xb8,
+    0xb8, 0x2f, 0x37, 0xd0, 0xb8,
+    0xb8, 0x0c, 0x8c, 0x80, 0xb8,
+    0xb8, 0x06, 0xef, 0x20, 0xb8,
+    0xb8, 0x01, 0xfc, 0x00, 0xb8,
+    0xb8, 0x00, 0x00, 0x00, 0xb8,
+    0xb8, 0x00, 0x00, 0x00, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // code=78
+    0x00, 0x00, 0x00, 0x00,
+    0x34, 0x00, 0x00, 0x14,
+    0xbf, 0x80, 0x00, 0x4f,
+    0xbd, 0xe1, 0x00, 0x4f,
+    0xb8, 0xd8, 0x00, 0x4f,
+    0xb8, 0x6f, 0x20, 0x4f,
+    0xb8, 0x0b, 0x90, 0x4f,
+    0xb8, 0x04, 0xf3, 0x4f,
+    0xb8, 0x00, 0xbb, 0x4f,
+    0xb8, 0x00, 0x2f, 0x8f,
+    0xb8, 0x00, 0x09, 0xef,
+    0xb8, 0x00, 0x02, 0xef,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // code=79
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x78, 0x72, 0x00, 0x00,
+    0x00, 0x8f, 0x98, 0x9f, 0x80, 0x00,
+    0x05, 0xe3, 0x00, 0x03, 0xe5, 0x00,
+    0x0d, 0x80, 0x00, 0x00, 0x8d, 0x00,
+    0x2f, 0x20, 0x00, 0x00, 0x2f, 0x20,
+    0x4f, 0x00, 0x00, 0x00, 0x0f, 0x40,
+    0x4f, 0x00, 0x00, 0x00, 0x0f, 0x40,
+    0x1f, 0x30, 0x00, 0x00, 0x3f, 0x10,
+    0x0b, 0x90, 0x00, 0x00, 0x9b, 0x00,
+    0x03, 0xf7, 0x00, 0x07, 0xe3, 0x00,
+    0x00, 0x4d, 0xdb, 0xdd, 0x30, 0x00,
+    0x00, 0x00, 0x34, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // code=80
+    0x00, 0x00, 0x00, 0x00,
+    0x34, 0x44, 0x20, 0x00,
+    0xbd, 0xbb, 0xeb, 0x10,
+    0xb8, 0x00, 0x1d, 0x80,
+    0xb8, 0x00, 0x08, 0xb0,
+    0xb8, 0x00, 0x09, 0xa0,
+    0xb9, 0x44, 0x8f, 0x50,
+    0xbd, 0xbb, 0x94, 0x00,
+    0xb8, 0x00, 0x00, 0x00,
+    0xb8, 0x00, 0x00, 0x00,
+    0xb8, 0x00, 0x00, 0x00,
+    0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // code=81
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x78, 0x72, 0x00, 0x00,
+    0x00, 0x8f, 0x98, 0x9f, 0x60, 0x00,
+    0x05, 0xe3, 0x00, 0x03, 0xe5, 0x00,
+    0x0d, 0x80, 0x00, 0x00, 0x8d, 0x00,
+    0x2f, 0x20, 0x00, 0x00, 0x2f, 0x20,
+    0x4f, 0x00, 0x00, 0x00, 0x0f, 0x40,
+    0x4f, 0x00, 0x00, 0x00, 0x0f, 0x40,
+    0x1f, 0x30, 0x00, 0x00, 0x3f, 0x10,
+    0x0b, 0x90, 0x00, 0x00, 0x9c, 0x00,
+    0x03, 0xe7, 0x00, 0x07, 0xf4, 0x00,
+    0x00, 0x3d, 0xdb, 0xde, 0x50, 0x00,
+    0x00, 0x00, 0x34, 0x9e, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0xa1, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // code=82
+    0x00, 0x00, 0x00, 0x00,
+    0x34, 0x44, 0x20, 0x00,
+    0xbd, 0xbb, 0xeb, 0x10,
+    0xb8, 0x00, 0x1d, 0x80,
+    0xb8, 0x00, 0x08, 0xb0,
+    0xb8, 0x00, 0x09, 0xa0,
+    0xb9, 0x44, 0x8f, 0x50,
+    0xbd, 0xbb, 0xfa, 0x00,
+    0xb8, 0x00, 0x3f, 0x50,
+    0xb8, 0x00, 0x08, 0xd0,
+    0xb8, 0x00, 0x02, 0xf4,
+    0xb8, 0x00, 0x00, 0x9b,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // code=83
+    0x00, 0x00, 0x00, 0x00,
+    0x01, 0x68, 0x85, 0x10,
+    0x5e, 0xa8, 0x8c, 0xb0,
+    0xd7, 0x00, 0x00, 0x10,
+    0xf4, 0x00, 0x00, 0x00,
+    0xbc, 0x50, 0x00, 0x00,
+    0x2a, 0xff, 0xc8, 0x10,
+    0x00, 0x14, 0x7e, 0xc0,
+    0x00, 0x00, 0x03, 0xf3,
+    0x00, 0x00, 0x00, 0xf4,
+    0xa2, 0x00, 0x08, 0xe0,
+    0xaf, 0xcb, 0xdd, 0x30,
+    0x00, 0x44, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // code=84
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x14, 0x44, 0x44, 0x44, 0x42,
+    0x3b, 0xbb, 0xde, 0xbb, 0xb6,
+    0x00, 0x00, 0x8b, 0x00, 0x00,
+    0x00, 0x00, 0x8b, 0x00, 0x00,
+    0x00, 0x00, 0x8b, 0x00, 0x00,
+    0x00, 0x00, 0x8b, 0x00, 0x00,
+    0x00, 0x00, 0x8b, 0x00, 0x00,
+    0x00, 0x00, 0x8b, 0x00, 0x00,
+    0x00, 0x00, 0x8b, 0x00, 0x00,
+    0x00, 0x00, 0x8b, 0x00, 0x00,
+    0x00, 0x00, 0x8b, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // code=85
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x23, 0x00, 0x00, 0x04, 0x10,
+    0x8b, 0x00, 0x00, 0x0f, 0x40,
+    0x8b, 0x00, 0x00, 0x0f, 0x40,
+    0x8b, 0x00, 0x00, 0x0f, 0x40,
+    0x8b, 0x00, 0x00, 0x0f, 0x40,
+    0x8b, 0x00, 0x00, 0x0f, 0x40,
+    0x8b, 0x00, 0x00, 0x0f, 0x40,
+    0x8b, 0x00, 0x00, 0x0f, 0x40,
+    0x6d, 0x00, 0x00, 0x2f, 0x20,
+    0x1e, 0x60, 0x00, 0xab, 0x00,
+    0x05, 0xdd, 0xbd, 0xb3, 0x00,
+    0x00, 0x03, 0x42, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // code=86
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x42, 0x00, 0x00, 0x01, 0x41,
+    0xa9, 0x00, 0x00, 0x06, 0xe0,
+    0x6e, 0x10, 0x00, 0x0b, 0x90,
+    0x0e, 0x60, 0x00, 0x2f, 0x30,
+    0x09, 0xb0, 0x00, 0x8d, 0x00,
+    0x03, 0xf2, 0x00, 0xd7, 0x00,
+    0x00, 0xd8, 0x04, 0xf2, 0x00,
+    0x00, 0x7d, 0x09, 0xa0, 0x00,
+    0x00, 0x2f, 0x5e, 0x60, 0x00,
+    0x00, 0x0a, 0xde, 0x00, 0x00,
+    0x00, 0x06, 0xf9, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // code=87
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x23, 0x00, 0x00, 0x44, 0x00, 0x00, 0x32,
+    0x5f, 0x00, 0x02, 0xff, 0x20, 0x00, 0xf5,
+    0x1f, 0x40, 0x06, 0xed, 0x60, 0x04, 0xf1,
+    0x0c, 0x80, 0x09, 0xa9, 0x90, 0x08, 0xc0,
+    0x08, 0xb0, 0x0d, 0x77, 0xd0, 0x0b, 0x80,
+    0x05, 0xf0, 0x2f, 0x33, 0xf2, 0x0f, 0x50,
+    0x01, 0xf4, 0x6e, 0x00, 0xe6, 0x4f, 0x10,
+    0x00, 0xc8, 0x9a, 0x00, 0xa9, 0x8c, 0x00,
+    0x00, 0x8b, 0xd7, 0x00, 0x7d, 0xb8, 0x00,
+    0x00, 0x5f, 0xf3, 0x00, 0x3f, 0xf5, 0x00,
+    0x00, 0x1f, 0xe0, 0x00, 0x0e, 0xf1, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // code=88
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x20, 0x00, 0x02, 0x40,
+    0x08, 0xe1, 0x00, 0x1e, 0x80,
+    0x00, 0xca, 0x00, 0xac, 0x00,
+    0x00, 0x3f, 0x57, 0xe3, 0x00,
+    0x00, 0x08, 0xee, 0x70, 0x00,
+    0x00, 0x00, 0xed, 0x00, 0x00,
+    0x00, 0x07, 0xef, 0x40, 0x00,
+    0x00, 0x2e, 0x78, 0xd1, 0x00,
+    0x00, 0xcb, 0x01, 0xd8, 0x00,
+    0x08, 0xe1, 0x00, 0x4f, 0x40,
+    0x3f, 0x50, 0x00, 0x08, 0xd1,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // code=89
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x14, 0x10, 0x00, 0x00, 0x42,
+    0x0b, 0xc0, 0x00, 0x08, 0xe1,
+    0x01, 0xe8, 0x00, 0x4f, 0x40,
+    0x00, 0x5f, 0x31, 0xd8, 0x00,
+    0x00, 0x09, 0xda, 0xc1, 0x00,
+    0x00, 0x01, 0xdf, 0x30, 0x00,
+    0x00, 0x00, 0x8b, 0x00, 0x00,
+    0x00, 0x00, 0x8b, 0x00, 0x00,
+    0x00, 0x00, 0x8b, 0x00, 0x00,
+    0x00, 0x00, 0x8b, 0x00, 0x00,
+    0x00, 0x00, 0x8b, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // code=90
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x44, 0x44, 0x44, 0x30,
+    0x0b, 0xbb, 0xbb, 0xbe, 0xb0,
+    0x00, 0x00, 0x00, 0x6f, 0x40,
+    0x00, 0x00, 0x03, 0xe7, 0x00,
+    0x00, 0x00, 0x1d, 0x90, 0x00,
+    0x00, 0x00, 0xbc, 0x10, 0x00,
+    0x00, 0x08, 0xe2, 0x00, 0x00,
+    0x00, 0x6f, 0x40, 0x00, 0x00,
+    0x03, 0xe8, 0x00, 0x00, 0x00,
+    0x1c, 0xa0, 0x00, 0x00, 0x00,
+    0x4f, 0xff, 0xff, 0xff, 0xf0,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // code=91
+    0x00, 0x00,
+    0x8b, 0xb3,
+    0xb9, 0x41,
+    0xb8, 0x00,
+    0xb8, 0x00,
+    0xb8, 0x00,
+    0xb8, 0x00,
+    0xb8, 0x00,
+    0xb8, 0x00,
+    0xb8, 0x00,
+    0xb8, 0x00,
+    0xb8, 0x00,
+    0xb9, 0x41,
+    0x8b, 0xb3,
+    0x00, 0x00,
+    0x00, 0x00,
+    // code=92
+    0x00, 0x00, 0x00,
+    0x41, 0x00, 0x00,
+    0xc8, 0x00, 0x00,
+    0x7c, 0x00, 0x00,
+    0x3f, 0x20, 0x00,
+    0x0d, 0x70, 0x00,
+    0x08, 0xa0, 0x00,
+    0x05, 0xf1, 0x00,
+    0x00, 0xe5, 0x00,
+    0x00, 0xa9, 0x00,
+    0x00, 0x6e, 0x00,
+    0x00, 0x1f, 0x30,
+    0x00, 0x0c, 0x80,
+    0x00, 0x02, 0x30,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // code=93
+    0x00, 0x00,
+    0x8b, 0xb3,
+    0x34, 0xf4,
+    0x00, 0xf4,
+    0x00, 0xf4,
+    0x00, 0xf4,
+    0x00, 0xf4,
+    0x00, 0xf4,
+    0x00, 0xf4,
+    0x00, 0xf4,
+    0x00, 0xf4,
+    0x00, 0xf4,
+    0x34, 0xf4,
+    0x8b, 0xb3,
+    0x00, 0x00,
+    0x00, 0x00,
+    // code=94
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x43, 0x00, 0x00,
+    0x00, 0x09, 0xef, 0x60, 0x00,
+    0x00, 0x9e, 0x36, 0xf6, 0x00,
+    0x09, 0xc3, 0x00, 0x5e, 0x60,
+    0x38, 0x10, 0x00, 0x03, 0x81,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // code=95
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3b, 0xbb, 0xbb, 0xbb, 0x30,
+    0x14, 0x44, 0x44, 0x44, 0x10,
+    // code=96
+    0x33, 0x00,
+    0x3e, 0x30,
+    0x03, 0xc1,
+    0x00, 0x32,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // code=97
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x08, 0xdf, 0xfa, 0x10,
+    0x07, 0x30, 0x19, 0xb0,
+    0x00, 0x00, 0x01, 0xf2,
+    0x01, 0x8b, 0xbb, 0xf4,
+    0x0d, 0xa5, 0x44, 0xf4,
+    0x4f, 0x00, 0x02, 0xf4,
+    0x3f, 0x30, 0x0a, 0xf4,
+    0x09, 0xfb, 0xd8, 0xf4,
+    0x00, 0x34, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // code=98
+    0x00, 0x00, 0x00, 0x00,
+    0x86, 0x00, 0x00, 0x00,
+    0xb8, 0x00, 0x00, 0x00,
+    0xb8, 0x00, 0x00, 0x00,
+    0xb8, 0xaf, 0xe8, 0x00,
+    0xbf, 0x70, 0x4e, 0x60,
+    0xbc, 0x00, 0x08, 0xc0,
+    0xb8, 0x00, 0x04, 0xf0,
+    0xb8, 0x00, 0x04, 0xf0,
+    0xba, 0x00, 0x07, 0xd0,
+    0xbf, 0x30, 0x1d, 0x80,
+    0xba, 0xeb, 0xeb, 0x10,
+    0x00, 0x04, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // code=99
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x8d, 0xff, 0x90,
+    0x08, 0xd4, 0x01, 0x40,
+    0x1f, 0x50, 0x00, 0x00,
+    0x4f, 0x00, 0x00, 0x00,
+    0x4f, 0x00, 0x00, 0x00,
+    0x2f, 0x30, 0x00, 0x00,
+    0x0b, 0xb1, 0x00, 0x10,
+    0x01, 0xbe, 0xbc, 0xb0,
+    0x00, 0x02, 0x44, 0x10,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // code=100
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x86,
+    0x00, 0x00, 0x00, 0xb8,
+    0x00, 0x00, 0x00, 0xb8,
+    0x01, 0x9f, 0xe8, 0xb8,
+    0x09, 0xc2, 0x19, 0xf8,
+    0x1f, 0x50, 0x01, 0xf8,
+    0x4f, 0x00, 0x00, 0xb8,
+    0x4f, 0x00, 0x00, 0xb8,
+    0x2f, 0x30, 0x00, 0xe8,
+    0x0b, 0xa0, 0x07, 0xf8,
+    0x03, 0xdd, 0xcc, 0xc8,
+    0x00, 0x04, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // code=101
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x8d, 0xfd, 0x50,
+    0x08, 0xc2, 0x04, 0xf4,
+    0x0f, 0x30, 0x00, 0x99,
+    0x4f, 0xbb, 0xbb, 0xdb,
+    0x4f, 0x44, 0x44, 0x43,
+    0x2f, 0x30, 0x00, 0x00,
+    0x0a, 0xc1, 0x00, 0x13,
+    0x01, 0xbe, 0xbb, 0xf6,
+    0x00, 0x02, 0x44, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // code=102
+    0x00, 0x00, 0x00,
+    0x00, 0x7b, 0xb3,
+    0x05, 0xe5, 0x41,
+    0x08, 0xb0, 0x00,
+    0x8d, 0xeb, 0x80,
+    0x39, 0xc4, 0x30,
+    0x08, 0xb0, 0x00,
+    0x08, 0xb0, 0x00,
+    0x08, 0xb0, 0x00,
+    0x08, 0xb0, 0x00,
+    0x08, 0xb0, 0x00,
+    0x08, 0xb0, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // code=103
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x01, 0x9f, 0xe8, 0x86,
+    0x09, 0xc2, 0x19, 0xf8,
+    0x1f, 0x30, 0x00, 0xe8,
+    0x4f, 0x00, 0x00, 0xb8,
+    0x4f, 0x00, 0x00, 0xb8,
+    0x1f, 0x30, 0x00, 0xe8,
+    0x09, 0xc2, 0x19, 0xf8,
+    0x01, 0x9f, 0xe8, 0xb8,
+    0x00, 0x00, 0x00, 0xd6,
+    0x02, 0x30, 0x19, 0xe1,
+    0x03, 0xdf, 0xfc, 0x30,
+    0x00, 0x00, 0x00, 0x00,
+    // code=104
+    0x00, 0x00, 0x00, 0x00,
+    0x86, 0x00, 0x00, 0x00,
+    0xb8, 0x00, 0x00, 0x00,
+    0xb8, 0x00, 0x00, 0x00,
+    0xb8, 0x8e, 0xf8, 0x00,
+    0xbe, 0x70, 0x3e, 0x70,
+    0xba, 0x00, 0x08, 0xb0,
+    0xb8, 0x00, 0x08, 0xb0,
+    0xb8, 0x00, 0x08, 0xb0,
+    0xb8, 0x00, 0x08, 0xb0,
+    0xb8, 0x00, 0x08, 0xb0,
+    0xb8, 0x00, 0x08, 0xb0,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // code=105
+    0x00,
+    0x86,
+    0x86,
+    0x00,
+    0x86,
+    0xb8,
+    0xb8,
+    0xb8,
+    0xb8,
+    0xb8,
+    0xb8,
+    0xb8,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // code=106
+    0x00, 0x00,
+    0x00, 0x86,
+    0x00, 0x86,
+    0x00, 0x00,
+    0x00, 0x86,
+    0x00, 0xb8,
+    0x00, 0xb8,
+    0x00, 0xb8,
+    0x00, 0xb8,
+    0x00, 0xb8,
+    0x00, 0xb8,
+    0x00, 0xb8,
+    0x00, 0xb8,
+    0x01, 0xd6,
+    0x4f, 0xa0,
+    0x00, 0x00,
+    // code=107
+    0x00, 0x00, 0x00, 0x00,
+    0x86, 0x00, 0x00, 0x00,
+    0xb8, 0x00, 0x00, 0x00,
+    0xb8, 0x00, 0x00, 0x00,
+    0xb8, 0x00, 0x6b, 0x30,
+    0xb8, 0x07, 0xf6, 0x00,
+    0xb8, 0x9e, 0x60, 0x00,
+    0xbe, 0xe3, 0x00, 0x00,
+    0xbc, 0xf6, 0x00, 0x00,
+    0xb8, 0x6f, 0x60, 0x00,
+    0xb8, 0x06, 0xf6, 0x00,
+    0xb8, 0x00, 0x6f, 0x70,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // code=108
+    0x00,
+    0x86,
+    0xb8,
+    0xb8,
+    0xb8,
+    0xb8,
+    0xb8,
+    0xb8,
+    0xb8,
+    0xb8,
+    0xb8,
+    0xb8,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // code=109
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x86, 0x8f, 0xe6, 0x08, 0xfe, 0x70,
+    0xbe, 0x70, 0x5f, 0xb7, 0x05, 0xf3,
+    0xb9, 0x00, 0x0c, 0x90, 0x00, 0xc8,
+    0xb8, 0x00, 0x0b, 0x80, 0x00, 0xb8,
+    0xb8, 0x00, 0x0b, 0x80, 0x00, 0xb8,
+    0xb8, 0x00, 0x0b, 0x80, 0x00, 0xb8,
+    0xb8, 0x00, 0x0b, 0x80, 0x00, 0xb8,
+    0xb8, 0x00, 0x0b, 0x80, 0x00, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // code=110
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x86, 0x8e, 0xf8, 0x00,
+    0xbe, 0x70, 0x3e, 0x70,
+    0xba, 0x00, 0x08, 0xb0,
+    0xb8, 0x00, 0x08, 0xb0,
+    0xb8, 0x00, 0x08, 0xb0,
+    0xb8, 0x00, 0x08, 0xb0,
+    0xb8, 0x00, 0x08, 0xb0,
+    0xb8, 0x00, 0x08, 0xb0,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // code=111
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x8e, 0xfc, 0x30,
+    0x08, 0xc2, 0x07, 0xe2,
+    0x1f, 0x50, 0x00, 0xc8,
+    0x4f, 0x00, 0x00, 0x8b,
+    0x4f, 0x00, 0x00, 0x8b,
+    0x2f, 0x30, 0x00, 0xa9,
+    0x0b, 0xa0, 0x03, 0xf4,
+    0x01, 0xcd, 0xbf, 0x60,
+    0x00, 0x03, 0x41, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // code=112
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x87, 0xaf, 0xe8, 0x00,
+    0xbf, 0x70, 0x4e, 0x60,
+    0xbc, 0x00, 0x08, 0xc0,
+    0xb8, 0x00, 0x04, 0xf0,
+    0xb8, 0x00, 0x04, 0xf0,
+    0xba, 0x00, 0x07, 0xd0,
+    0xbf, 0x30, 0x1d, 0x80,
+    0xba, 0xeb, 0xeb, 0x10,
+    0xb8, 0x04, 0x30, 0x00,
+    0xb8, 0x00, 0x00, 0x00,
+    0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // code=113
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x01, 0x9f, 0xe8, 0x86,
+    0x09, 0xc2, 0x19, 0xf8,
+    0x1f, 0x50, 0x01, 0xf8,
+    0x4f, 0x00, 0x00, 0xb8,
+    0x4f, 0x00, 0x00, 0xb8,
+    0x2f, 0x30, 0x00, 0xe8,
+    0x0b, 0xa0, 0x07, 0xf8,
+    0x03, 0xdd, 0xcc, 0xc8,
+    0x00, 0x04, 0x30, 0xb8,
+    0x00, 0x00, 0x00, 0xb8,
+    0x00, 0x00, 0x00, 0xb8,
+    0x00, 0x00, 0x00, 0x00,
+    // code=114
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x86, 0x8e, 0xb0,
+    0xbe, 0x70, 0x10,
+    0xba, 0x00, 0x00,
+    0xb8, 0x00, 0x00,
+    0xb8, 0x00, 0x00,
+    0xb8, 0x00, 0x00,
+    0xb8, 0x00, 0x00,
+    0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // code=115
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x06, 0xdf, 0xfc, 0x00,
+    0x2f, 0x50, 0x05, 0x00,
+    0x4f, 0x10, 0x00, 0x00,
+    0x0c, 0xe9, 0x61, 0x00,
+    0x01, 0x69, 0xee, 0x20,
+    0x00, 0x00, 0x1d, 0x80,
+    0x22, 0x00, 0x1d, 0x70,
+    0x3f, 0xcb, 0xeb, 0x00,
+    0x00, 0x44, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // code=116
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x0b, 0x80, 0x00,
+    0x0b, 0x80, 0x00,
+    0x8e, 0xdb, 0xb0,
+    0x3c, 0x94, 0x40,
+    0x0b, 0x80, 0x00,
+    0x0b, 0x80, 0x00,
+    0x0b, 0x80, 0x00,
+    0x0b, 0x80, 0x00,
+    0x0a, 0xa0, 0x00,
+    0x03, 0xdf, 0xf0,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    // code=117
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x86, 0x00, 0x06, 0x80,
+    0xb8, 0x00, 0x08, 0xb0,
+    0xb8, 0x00, 0x08, 0xb0,
+    0xb8, 0x00, 0x08, 0xb0,
+    0xb8, 0x00, 0x08, 0xb0,
+    0xb8, 0x00, 0x09, 0xb0,
+    0x8d, 0x10, 0x3e, 0xb0,
+    0x1c, 0xdb, 0xc8, 0xb0,
+    0x00, 0x44, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // code=118
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x4b, 0x00, 0x00, 0x69,
+    0x1f, 0x50, 0x00, 0xc8,
+    0x09, 0xa0, 0x03, 0xf2,
+    0x05, 0xf1, 0x08, 0xc0,
+    0x00, 0xd6, 0x0e, 0x60,
+    0x00, 0x8c, 0x5f, 0x10,
+    0x00, 0x2f, 0xba, 0x00,
+    0x00, 0x0c, 0xf5, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // code=119
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5a, 0x00, 0x2b, 0x50, 0x08, 0x80,
+    0x3f, 0x20, 0x6e, 0x90, 0x0d, 0x70,
+    0x0e, 0x60, 0x98, 0xd0, 0x2f, 0x30,
+    0x0a, 0x90, 0xd2, 0xd2, 0x6e, 0x00,
+    0x06, 0xd2, 0xd0, 0x96, 0x9a, 0x00,
+    0x02, 0xf8, 0x90, 0x6a, 0xd6, 0x00,
+    0x00, 0xde, 0x60, 0x2e, 0xf2, 0x00,
+    0x00, 0x9f, 0x20, 0x0d, 0xd0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // code=120
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x1a, 0x70, 0x01, 0xb6,
+    0x05, 0xf3, 0x0b, 0xc0,
+    0x00, 0x9d, 0x8e, 0x30,
+    0x00, 0x1c, 0xf6, 0x00,
+    0x00, 0x1d, 0xf6, 0x00,
+    0x00, 0xac, 0x8e, 0x30,
+    0x07, 0xe3, 0x0a, 0xc1,
+    0x3e, 0x70, 0x01, 0xd9,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // code=121
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x4b, 0x00, 0x00, 0x69,
+    0x1e, 0x60, 0x00, 0xd8,
+    0x08, 0xb0, 0x03, 0xf2,
+    0x02, 0xf3, 0x09, 0xb0,
+    0x00, 0xb9, 0x1e, 0x60,
+    0x00, 0x6e, 0x7e, 0x00,
+    0x00, 0x0d, 0xf8, 0x00,
+    0x00, 0x08, 0xf2, 0x00,
+    0x00, 0x08, 0xb0, 0x00,
+    0x00, 0x1d, 0x60, 0x00,
+    0x0b, 0xf8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // code=122
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x3b, 0xbb, 0xbb, 0x80,
+    0x14, 0x44, 0x5e, 0x80,
+    0x00, 0x01, 0xcc, 0x10,
+    0x00, 0x09, 0xe1, 0x00,
+    0x00, 0x8e, 0x30, 0x00,
+    0x06, 0xf5, 0x00, 0x00,
+    0x3f, 0x60, 0x00, 0x00,
+    0x8f, 0xff, 0xff, 0xb0,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // code=123
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x9b, 0x30,
+    0x00, 0x0d, 0x94, 0x10,
+    0x00, 0x0f, 0x40, 0x00,
+    0x00, 0x0f, 0x40, 0x00,
+    0x00, 0x0f, 0x40, 0x00,
+    0x00, 0x4f, 0x30, 0x00,
+    0x3b, 0xe8, 0x00, 0x00,
+    0x14, 0xae, 0x10, 0x00,
+    0x00, 0x1f, 0x40, 0x00,
+    0x00, 0x0f, 0x40, 0x00,
+    0x00, 0x0f, 0x40, 0x00,
+    0x00, 0x0f, 0x50, 0x00,
+    0x00, 0x08, 0xeb, 0x30,
+    0x00, 0x00, 0x24, 0x10,
+    0x00, 0x00, 0x00, 0x00,
+    // code=124
+    0x00,
+    0x3b,
+    0x4f,
+    0x4f,
+    0x4f,
+    0x4f,
+    0x4f,
+    0x4f,
+    0x4f,
+    0x4f,
+    0x4f,
+    0x4f,
+    0x4f,
+    0x4f,
+    0x4f,
+    0x14,
+    // code=125
+    0x00, 0x00, 0x00, 0x00,
+    0x3b, 0x93, 0x00, 0x00,
+    0x14, 0x9d, 0x00, 0x00,
+    0x00, 0x4f, 0x00, 0x00,
+    0x00, 0x4f, 0x00, 0x00,
+    0x00, 0x4f, 0x00, 0x00,
+    0x00, 0x3f, 0x40, 0x00,
+    0x00, 0x08, 0xeb, 0x30,
+    0x00, 0x1e, 0xa4, 0x10,
+    0x00, 0x4f, 0x00, 0x00,
+    0x00, 0x4f, 0x00, 0x00,
+    0x00, 0x4f, 0x00, 0x00,
+    0x00, 0x5f, 0x00, 0x00,
+    0x3b, 0xe8, 0x00, 0x00,
+    0x14, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    // code=126
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x78, 0x30, 0x00, 0x22,
+    0x5e, 0xbc, 0xfc, 0x89, 0xe3,
+    0x52, 0x00, 0x28, 0xb9, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00
+};
+
+static const FONT_GLYPH_T DEJAVU_AA16_glyph_info[] = {
+    { 0, 1, 5, 0 },  // code=32
+    { 16, 2, 6, 2 },  // code=33
+    { 32, 5, 7, 1 },  // code=34
+    { 80, 10, 12, 1 },  // code=35
+    { 160, 7, 9, 1 },  // code=36
+    { 224, 13, 13, 0 },  // code=37
+    { 336, 11, 11, 0 },  // code=38
+    { 432, 2, 4, 1 },  // code=39
+    { 448, 4, 6, 1 },  // code=40
+    { 480, 4, 6, 1 },  // code=41
+    { 512, 7, 7, 0 },  // code=42
+    { 576, 10, 12, 1 },  // code=43
+    { 656, 2, 5, 1 },  // code=44
+    { 672, 5, 5, 0 },  // code=45
+    { 720, 2, 5, 1 },  // code=46
+    { 736, 5, 5, 0 },  // code=47
+    { 784, 7, 9, 1 },  // code=48
+    { 848, 7, 9, 1 },  // code=49
+    { 912, 7, 9, 1 },  // code=50
+    { 976, 7, 9, 1 },  // code=51
+    { 1040, 9, 9, 0 },  // code=52
+    { 1120, 7, 9, 1 },  // code=53
+    { 1184, 7, 9, 1 },  // code=54
+    { 1248, 7, 9, 1 },  // code=55
+    { 1312, 7, 9, 1 },  // code=56
+    { 1376, 7, 9, 1 },  // code=57
+    { 1440, 3, 5, 1 },  // code=58
+    { 1472, 2, 5, 1 },  // code=59
+    { 1488, 10, 12, 1 },  // code=60
+    { 1568, 10, 12, 1 },  // code=61
+    { 1648, 10, 12, 1 },  // code=62
+    { 1728, 6, 8, 1 },  // code=63
+    { 1776, 12, 14, 1 },  // code=64
+    { 1872, 10, 10, 0 },  // code=65
+    { 1952, 8, 10, 1 },  // code=66
+    { 2016, 9, 10, 0 },  // code=67
+    { 2096, 9, 11, 1 },  // code=68
+    { 2176, 7, 9, 1 },  // code=69
+    { 2240, 6, 8, 1 },  // code=70
+    { 2288, 10, 11, 0 },  // code=71
+    { 2368, 8, 11, 1 },  // code=72
+    { 2432, 2, 4, 1 },  // code=73
+    { 2448, 4, 4, -1 },  // code=74
+    { 2480, 9, 9, 1 },  // code=75
+    { 2560, 7, 8, 1 },  // code=76
+    { 2624, 10, 12, 1 },  // code=77
+    { 2704, 8, 11, 1 },  // code=78
+    { 2768, 11, 11, 0 },  // code=79
+    { 2864, 7, 9, 1 },  // code=80
+    { 2928, 11, 11, 0 },  // code=81
+    { 3024, 8, 10, 1 },  // code=82
+    { 3088, 8, 9, 1 },  // code=83
+    { 3152, 10, 9, -1 },  // code=84
+    { 3232, 9, 10, 1 },  // code=85
+    { 3312, 10, 10, 0 },  // code=86
+    { 3392, 14, 14, 0 },  // code=87
+    { 3504, 10, 10, 0 },  // code=88
+    { 3584, 10, 9, -1 },  // code=89
+    { 3664, 9, 10, 0 },  // code=90
+    { 3744, 4, 6, 1 },  // code=91
+    { 3776, 5, 5, 0 },  // code=92
+    { 3824, 4, 6, 1 },  // code=93
+    { 3856, 10, 12, 1 },  // code=94
+    { 3936, 9, 7, -1 },  // code=95
+    { 4016, 4, 7, 1 },  // code=96
+    { 4048, 8, 9, 0 },  // code=97
+    { 4112, 7, 9, 1 },  // code=98
+    { 4176, 7, 8, 0 },  // code=99
+    { 4240, 8, 9, 0 },  // code=100
+    { 4304, 8, 9, 0 },  // code=101
+    { 4368, 6, 5, 0 },  // code=102
+    { 4416, 8, 9, 0 },  // code=103
+    { 4480, 7, 9, 1 },  // code=104
+    { 4544, 2, 4, 1 },  // code=105
+    { 4560, 4, 4, -1 },  // code=106
+    { 4592, 7, 8, 1 },  // code=107
+    { 4656, 2, 4, 1 },  // code=108
+    { 4672, 12, 14, 1 },  // code=109
+    { 4768, 7, 9, 1 },  // code=110
+    { 4832, 8, 9, 0 },  // code=111
+    { 4896, 7, 9, 1 },  // code=112
+    { 4960, 8, 9, 0 },  // code=113
+    { 5024, 5, 6, 1 },  // code=114
+    { 5072, 7, 7, 0 },  // code=115
+    { 5136, 5, 6, 0 },  // code=116
+    { 5184, 7, 9, 1 },  // code=117
+    { 5248, 8, 8, 0 },  // code=118
+    { 5312, 11, 12, 0 },  // code=119
+    { 5408, 8, 8, 0 },  // code=120
+    { 5472, 8, 8, 0 },  // code=121
+    { 5536, 7, 7, 0 },  // code=122
+    { 5600, 7, 9, 1 },  // code=123
+    { 5664, 2, 5, 1 },  // code=124
+    { 5680, 7, 9, 1 },  // code=125
+    { 5744, 10, 12, 1 },  // code=126
+};
+
+static const FONT_KERN_T DEJAVU_AA16_kern[] = {
+    { 45, 66, -1 },
+    { 45, 71, 1 },
+    { 45, 74, 1 },
+    { 45, 79, 1 },
+    { 45, 81, 1 },
+    { 45, 84, -1 },
+    { 45, 86, -1 },
+    { 45, 87, -1 },
+    { 45, 88, -1 },
+    { 45, 89, -2 },
+    { 65, 65, 1 },
+    { 65, 84, -1 },
+    { 65, 86, -1 },
+    { 65, 87, -1 },
+    { 65, 89, -1 },
+    { 65, 102, -1 },
+    { 65, 118, -1 },
+    { 65, 119, -1 },
+    { 65, 121, -1 },
+    { 66, 86, -1 },
+    { 66, 87, -1 },
+    { 66, 89, -1 },
+    { 68, 89, -1 },
+    { 70, 46, -2 },
+    { 70, 58, -1 },
+    { 70, 65, -1 },
+    { 70, 97, -1 },
+    { 70, 101, -1 },
+    { 70, 105, -1 },
+    { 70, 111, -1 },
+    { 70, 114, -1 },
+    { 70, 117, -1 },
+    { 70, 121, -1 },
+    { 71, 84, -1 },
+    { 71, 89, -1 },
+    { 74, 45, -1 },
+    { 75, 45, -2 },
+    { 75, 67, -1 },
+    { 75, 79, -1 },
+    { 75, 84, -1 },
+    { 75, 87, -1 },
+    { 75, 89, -1 },
+    { 75, 101, -1 },
+    { 75, 111, -1 },
+    { 75, 117, -1 },
+    { 75, 121, -1 },
+    { 76, 79, -1 },
+    { 76, 84, -2 },
+    { 76, 85, -1 },
+    { 76, 86, -2 },
+    { 76, 87, -1 },
+    { 76, 89, -2 },
+    { 76, 121, -1 },
+    { 79, 45, 1 },
+    { 79, 46, -1 },
+    { 79, 88, -1 },
+    { 79, 89, -1 },
+    { 80, 46, -2 },
+    { 80, 65, -1 },
+    { 80, 97, -1 },
+    { 80, 101, -1 },
+    { 80, 111, -1 },
+    { 81, 45, 1 },
+    { 82, 45, -1 },
+    { 82, 46, -1 },
+    { 82, 58, -1 },
+    { 82, 65, -1 },
+    { 82, 67, -1 },
+    { 82, 84, -1 },
+    { 82, 86, -1 },
+    { 82, 87, -1 },
+    { 82, 89, -1 },
+    { 82, 101, -1 },
+    { 82, 111, -1 },
+    { 82, 117, -1 },
+    { 82, 121, -1 },
+    { 84, 45, -1 },
+    { 84, 46, -2 },
+    { 84, 58, -2 },
+    { 84, 65, -1 },
+    { 84, 67, -1 },
+    { 84, 97, -2 },
+    { 84, 99, -3 },
+    { 84, 101, -3 },
+    { 84, 105, -1 },
+    { 84, 111, -3 },
+    { 84, 114, -2 },
+    { 84, 115, -2 },
+    { 84, 117, -2 },
+    { 84, 119, -2 },
+    { 84, 121, -2 },
+    { 86, 45, -1 },
+    { 86, 46, -2 },
+    { 86, 58, -1 },
+    { 86, 65, -1 },
+    { 86, 97, -1 },
+    { 86, 101, -1 },
+    { 86, 111, -1 },
+    { 86, 117, -1 },
+    { 87, 45, -1 },
+    { 87, 46, -2 },
+    { 87, 58, -1 },
+    { 87, 65, -1 },
+    { 87, 97, -1 },
+    { 87, 101, -1 },
+    { 87, 111, -1 },
+    { 87, 114, -1 },
+    { 87, 117, -1 },
+    { 88, 45, -1 },
+    { 88, 67, -1 },
+    { 88, 79, -1 },
+    { 88, 101, -1 },
+    { 89, 45, -2 },
+    { 89, 46, -3 },
+    { 89, 58, -2 },
+    { 89, 65, -1 },
+    { 89, 67, -1 },
+    { 89, 79, -1 },
+    { 89, 97, -2 },
+    { 89, 101, -2 },
+    { 89, 105, -1 },
+    { 89, 111, -2 },
+    { 89, 117, -2 },
+    { 102, 45, -1 },
+    { 102, 46, -1 },
+    { 102, 58, -1 },
+    { 107, 101, -1 },
+    { 107, 111, -1 },
+    { 107, 117, -1 },
+    { 107, 121, -1 },
+    { 111, 120, -1 },
+    { 114, 45, -1 },
+    { 114, 46, -1 },
+    { 118, 46, -1 },
+    { 118, 58, -1 },
+    { 119, 46, -1 },
+    { 119, 58, -1 },
+    { 120, 101, -1 },
+    { 120, 111, -1 },
+    { 121, 46, -2 },
+    { 121, 58, -1 },
+};
+
+#endif
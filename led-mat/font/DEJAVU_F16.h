@@ -0,0 +1,1786 @@
+// DEJAVU_F16, converted from DejaVuSans14.bdf by led-bdf
+// DejaVu Sans Book drawn at 14 pixels to the em, with the pairs of its kern table
+// Copyright (c) 2003 by Bitstream, Inc. All Rights Reserved. DejaVu changes are in public domain.
+// Bitstream Vera is a trademark of Bitstream, Inc. See DEJAVU-LICENSE.txt for the license.
+
+#ifndef __DEJAVU_F16_H
+#define __DEJAVU_F16_H
+
+static const uint8_t DEJAVU_F16_glyphs[] = {
+    // code=32
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // code=33
+    0x00,
+    0x00,
+    0x00,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x00,
+    0x00,
+    0x80,
+    0x80,
+    0x00,
+    0x00,
+    0x00,
+    // code=34
+    0x00,
+    0x00,
+    0x00,
+    0xa0,
+    0xa0,
+    0xa0,
+    0xa0,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // code=35
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x09, 0x00,
+    0x09, 0x00,
+    0x09, 0x00,
+    0x7f, 0xc0,
+    0x12, 0x00,
+    0x12, 0x00,
+    0xff, 0x80,
+    0x26, 0x00,
+    0x24, 0x00,
+    0x24, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // code=36
+    0x00,
+    0x00,
+    0x10,
+    0x10,
+    0x7c,
+    0x92,
+    0x90,
+    0xd0,
+    0x7c,
+    0x16,
+    0x12,
+    0x92,
+    0x7c,
+    0x10,
+    0x10,
+    0x00,
+    // code=37
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x70, 0x80,
+    0x88, 0x80,
+    0x89, 0x00,
+    0x8b, 0x00,
+    0x8a, 0xe0,
+    0x75, 0x10,
+    0x0d, 0x10,
+    0x09, 0x10,
+    0x11, 0x10,
+    0x10, 0xe0,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // code=38
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x38, 0x00,
+    0x44, 0x00,
+    0x40, 0x00,
+    0x20, 0x00,
+    0x50, 0x00,
+    0x88, 0x40,
+    0x84, 0x40,
+    0x82, 0x80,
+    0x43, 0x00,
+    0x3c, 0xc0,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // code=39
+    0x00,
+    0x00,
+    0x00,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // code=40
+    0x00,
+    0x00,
+    0x60,
+    0x40,
+    0x40,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x40,
+    0x40,
+    0x20,
+    0x00,
+    0x00,
+    // code=41
+    0x00,
+    0x00,
+    0x80,
+    0x40,
+    0x40,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x40,
+    0x40,
+    0x80,
+    0x00,
+    0x00,
+    // code=42
+    0x00,
+    0x00,
+    0x00,
+    0x10,
+    0x92,
+    0x7c,
+    0x38,
+    0xd6,
+    0x10,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // code=43
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x08, 0x00,
+    0x08, 0x00,
+    0x08, 0x00,
+    0x08, 0x00,
+    0xff, 0x80,
+    0x08, 0x00,
+    0x08, 0x00,
+    0x08, 0x00,
+    0x08, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // code=44
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x40,
+    0x40,
+    0x80,
+    0x00,
+    0x00,
+    // code=45
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0xf0,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // code=46
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x80,
+    0x80,
+    0x00,
+    0x00,
+    0x00,
+    // code=47
+    0x00,
+    0x00,
+    0x00,
+    0x08,
+    0x18,
+    0x10,
+    0x10,
+    0x30,
+    0x20,
+    0x20,
+    0x60,
+    0x40,
+    0x40,
+    0xc0,
+    0x80,
+    0x00,
+    // code=48
+    0x00,
+    0x00,
+    0x00,
+    0x38,
+    0x44,
+    0x82,
+    0x82,
+    0x82,
+    0x82,
+    0x82,
+    0x82,
+    0x44,
+    0x38,
+    0x00,
+    0x00,
+    0x00,
+    // code=49
+    0x00,
+    0x00,
+    0x00,
+    0x60,
+    0xa0,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0xf8,
+    0x00,
+    0x00,
+    0x00,
+    // code=50
+    0x00,
+    0x00,
+    0x00,
+    0x78,
+    0x8c,
+    0x04,
+    0x04,
+    0x0c,
+    0x08,
+    0x10,
+    0x20,
+    0x40,
+    0xfc,
+    0x00,
+    0x00,
+    0x00,
+    // code=51
+    0x00,
+    0x00,
+    0x00,
+    0x7c,
+    0x86,
+    0x02,
+    0x02,
+    0x3c,
+    0x06,
+    0x02,
+    0x02,
+    0x86,
+    0x78,
+    0x00,
+    0x00,
+    0x00,
+    // code=52
+    0x00,
+    0x00,
+    0x00,
+    0x0c,
+    0x14,
+    0x24,
+    0x24,
+    0x44,
+    0x84,
+    0xfe,
+    0x04,
+    0x04,
+    0x04,
+    0x00,
+    0x00,
+    0x00,
+    // code=53
+    0x00,
+    0x00,
+    0x00,
+    0xfc,
+    0x80,
+    0x80,
+    0xf8,
+    0x84,
+    0x02,
+    0x02,
+    0x02,
+    0x84,
+    0x78,
+    0x00,
+    0x00,
+    0x00,
+    // code=54
+    0x00,
+    0x00,
+    0x00,
+    0x3c,
+    0x62,
+    0xc0,
+    0x80,
+    0xbc,
+    0xc6,
+    0x82,
+    0x82,
+    0x46,
+    0x3c,
+    0x00,
+    0x00,
+    0x00,
+    // code=55
+    0x00,
+    0x00,
+    0x00,
+    0xfe,
+    0x04,
+    0x04,
+    0x08,
+    0x08,
+    0x10,
+    0x10,
+    0x20,
+    0x20,
+    0x40,
+    0x00,
+    0x00,
+    0x00,
+    // code=56
+    0x00,
+    0x00,
+    0x00,
+    0x7c,
+    0xc6,
+    0x82,
+    0xc6,
+    0x38,
+    0xc6,
+    0x82,
+    0x82,
+    0xc6,
+    0x7c,
+    0x00,
+    0x00,
+    0x00,
+    // code=57
+    0x00,
+    0x00,
+    0x00,
+    0x78,
+    0xc4,
+    0x82,
+    0x82,
+    0xc6,
+    0x7a,
+    0x02,
+    0x06,
+    0x8c,
+    0x78,
+    0x00,
+    0x00,
+    0x00,
+    // code=58
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x80,
+    0x80,
+    0x00,
+    0x00,
+    0x00,
+    0x80,
+    0x80,
+    0x00,
+    0x00,
+    0x00,
+    // code=59
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x40,
+    0x40,
+    0x00,
+    0x00,
+    0x00,
+    0x40,
+    0x40,
+    0x80,
+    0x00,
+    0x00,
+    // code=60
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x80,
+    0x07, 0x00,
+    0x38, 0x00,
+    0xe0, 0x00,
+    0xe0, 0x00,
+    0x38, 0x00,
+    0x07, 0x00,
+    0x00, 0x80,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // code=61
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0xff, 0x80,
+    0x00, 0x00,
+    0x00, 0x00,
+    0xff, 0x80,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // code=62
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x80, 0x00,
+    0x70, 0x00,
+    0x0e, 0x00,
+    0x03, 0x80,
+    0x03, 0x80,
+    0x0e, 0x00,
+    0x70, 0x00,
+    0x80, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // code=63
+    0x00,
+    0x00,
+    0x00,
+    0x70,
+    0x88,
+    0x08,
+    0x18,
+    0x30,
+    0x20,
+    0x20,
+    0x00,
+    0x20,
+    0x20,
+    0x00,
+    0x00,
+    0x00,
+    // code=64
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x0f, 0x80,
+    0x30, 0x40,
+    0x40, 0x20,
+    0x4e, 0x90,
+    0x99, 0x90,
+    0x90, 0x90,
+    0x90, 0x90,
+    0x99, 0xa0,
+    0x4e, 0xc0,
+    0x40, 0x00,
+    0x30, 0x40,
+    0x0f, 0x80,
+    0x00, 0x00,
+    // code=65
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x08, 0x00,
+    0x14, 0x00,
+    0x14, 0x00,
+    0x22, 0x00,
+    0x22, 0x00,
+    0x22, 0x00,
+    0x7f, 0x00,
+    0x41, 0x00,
+    0x41, 0x00,
+    0x80, 0x80,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // code=66
+    0x00,
+    0x00,
+    0x00,
+    0xfe,
+    0x83,
+    0x81,
+    0x83,
+    0xfe,
+    0x83,
+    0x81,
+    0x81,
+    0x83,
+    0xfe,
+    0x00,
+    0x00,
+    0x00,
+    // code=67
+    0x00,
+    0x00,
+    0x00,
+    0x3e,
+    0x61,
+    0xc0,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0xc0,
+    0x61,
+    0x3e,
+    0x00,
+    0x00,
+    0x00,
+    // code=68
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0xfc, 0x00,
+    0x83, 0x00,
+    0x81, 0x80,
+    0x80, 0x80,
+    0x80, 0x80,
+    0x80, 0x80,
+    0x80, 0x80,
+    0x81, 0x80,
+    0x83, 0x00,
+    0xfc, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // code=69
+    0x00,
+    0x00,
+    0x00,
+    0xfe,
+    0x80,
+    0x80,
+    0x80,
+    0xfe,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0xfe,
+    0x00,
+    0x00,
+    0x00,
+    // code=70
+    0x00,
+    0x00,
+    0x00,
+    0xfc,
+    0x80,
+    0x80,
+    0x80,
+    0xfc,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x00,
+    0x00,
+    0x00,
+    // code=71
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x1f, 0x00,
+    0x60, 0x80,
+    0x40, 0x00,
+    0x80, 0x00,
+    0x80, 0x00,
+    0x83, 0x80,
+    0x80, 0x80,
+    0x40, 0x80,
+    0x60, 0x80,
+    0x1f, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // code=72
+    0x00,
+    0x00,
+    0x00,
+    0x81,
+    0x81,
+    0x81,
+    0x81,
+    0xff,
+    0x81,
+    0x81,
+    0x81,
+    0x81,
+    0x81,
+    0x00,
+    0x00,
+    0x00,
+    // code=73
+    0x00,
+    0x00,
+    0x00,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x00,
+    0x00,
+    0x00,
+    // code=74
+    0x00,
+    0x00,
+    0x00,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0xc0,
+    // code=75
+    0x00,
+    0x00,
+    0x00,
+    0x82,
+    0x84,
+    0x88,
+    0x90,
+    0xe0,
+    0xa0,
+    0x90,
+    0x88,
+    0x84,
+    0x82,
+    0x00,
+    0x00,
+    0x00,
+    // code=76
+    0x00,
+    0x00,
+    0x00,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0xfc,
+    0x00,
+    0x00,
+    0x00,
+    // code=77
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0xc0, 0xc0,
+    0xc0, 0xc0,
+    0xa1, 0x40,
+    0xa1, 0x40,
+    0x92, 0x40,
+    0x92, 0x40,
+    0x8c, 0x40,
+    0x8c, 0x40,
+    0x80, 0x40,
+    0x80, 0x40,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // code=78
+    0x00,
+    0x00,
+    0x00,
+    0xc1,
+    0xc1,
+    0xa1,
+    0x91,
+    0x91,
+    0x89,
+    0x89,
+    0x85,
+    0x83,
+    0x83,
+    0x00,
+    0x00,
+    0x00,
+    // code=79
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x3e, 0x00,
+    0x63, 0x00,
+    0xc1, 0x80,
+    0x80, 0x80,
+    0x80, 0x80,
+    0x80, 0x80,
+    0x80, 0x80,
+    0xc1, 0x80,
+    0x63, 0x00,
+    0x3e, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // code=80
+    0x00,
+    0x00,
+    0x00,
+    0xfc,
+    0x86,
+    0x82,
+    0x82,
+    0x86,
+    0xfc,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x00,
+    0x00,
+    0x00,
+    // code=81
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x3e, 0x00,
+    0x63, 0x00,
+    0xc1, 0x80,
+    0x80, 0x80,
+    0x80, 0x80,
+    0x80, 0x80,
+    0x80, 0x80,
+    0xc1, 0x80,
+    0x63, 0x00,
+    0x3e, 0x00,
+    0x02, 0x00,
+    0x01, 0x00,
+    0x00, 0x00,
+    // code=82
+    0x00,
+    0x00,
+    0x00,
+    0xfc,
+    0x86,
+    0x82,
+    0x82,
+    0x86,
+    0xfc,
+    0x86,
+    0x82,
+    0x82,
+    0x81,
+    0x00,
+    0x00,
+    0x00,
+    // code=83
+    0x00,
+    0x00,
+    0x00,
+    0x7c,
+    0xc2,
+    0x80,
+    0x80,
+    0x60,
+    0x1c,
+    0x02,
+    0x02,
+    0x86,
+    0x7c,
+    0x00,
+    0x00,
+    0x00,
+    // code=84
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0xff, 0x80,
+    0x08, 0x00,
+    0x08, 0x00,
+    0x08, 0x00,
+    0x08, 0x00,
+    0x08, 0x00,
+    0x08, 0x00,
+    0x08, 0x00,
+    0x08, 0x00,
+    0x08, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // code=85
+    0x00,
+    0x00,
+    0x00,
+    0x81,
+    0x81,
+    0x81,
+    0x81,
+    0x81,
+    0x81,
+    0x81,
+    0x81,
+    0x42,
+    0x3c,
+    0x00,
+    0x00,
+    0x00,
+    // code=86
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x80, 0x80,
+    0x41, 0x00,
+    0x41, 0x00,
+    0x41, 0x00,
+    0x22, 0x00,
+    0x22, 0x00,
+    0x14, 0x00,
+    0x14, 0x00,
+    0x14, 0x00,
+    0x08, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // code=87
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x82, 0x08,
+    0x85, 0x08,
+    0x45, 0x10,
+    0x45, 0x10,
+    0x45, 0x10,
+    0x28, 0xa0,
+    0x28, 0xa0,
+    0x28, 0xa0,
+    0x28, 0xa0,
+    0x10, 0x40,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // code=88
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0xc1, 0x80,
+    0x41, 0x00,
+    0x22, 0x00,
+    0x14, 0x00,
+    0x08, 0x00,
+    0x18, 0x00,
+    0x14, 0x00,
+    0x22, 0x00,
+    0x41, 0x00,
+    0xc1, 0x80,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // code=89
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0xc1, 0x80,
+    0x41, 0x00,
+    0x22, 0x00,
+    0x22, 0x00,
+    0x14, 0x00,
+    0x08, 0x00,
+    0x08, 0x00,
+    0x08, 0x00,
+    0x08, 0x00,
+    0x08, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // code=90
+    0x00,
+    0x00,
+    0x00,
+    0xff,
+    0x01,
+    0x02,
+    0x04,
+    0x08,
+    0x10,
+    0x20,
+    0x40,
+    0x80,
+    0xff,
+    0x00,
+    0x00,
+    0x00,
+    // code=91
+    0x00,
+    0x00,
+    0xe0,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0xe0,
+    0x00,
+    0x00,
+    // code=92
+    0x00,
+    0x00,
+    0x00,
+    0x80,
+    0xc0,
+    0x40,
+    0x40,
+    0x60,
+    0x20,
+    0x20,
+    0x30,
+    0x10,
+    0x10,
+    0x18,
+    0x08,
+    0x00,
+    // code=93
+    0x00,
+    0x00,
+    0xe0,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0xe0,
+    0x00,
+    0x00,
+    // code=94
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x1c, 0x00,
+    0x36, 0x00,
+    0x63, 0x00,
+    0xc1, 0x80,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // code=95
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0xfe,
+    // code=96
+    0x00,
+    0xc0,
+    0x40,
+    0x20,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    // code=97
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x78,
+    0x84,
+    0x04,
+    0x7c,
+    0x84,
+    0x84,
+    0x8c,
+    0x74,
+    0x00,
+    0x00,
+    0x00,
+    // code=98
+    0x00,
+    0x00,
+    0x80,
+    0x80,
+    0x80,
+    0xb8,
+    0xc4,
+    0x82,
+    0x82,
+    0x82,
+    0x82,
+    0xc4,
+    0xb8,
+    0x00,
+    0x00,
+    0x00,
+    // code=99
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x38,
+    0x44,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x44,
+    0x38,
+    0x00,
+    0x00,
+    0x00,
+    // code=100
+    0x00,
+    0x00,
+    0x02,
+    0x02,
+    0x02,
+    0x3a,
+    0x46,
+    0x82,
+    0x82,
+    0x82,
+    0x82,
+    0x46,
+    0x3a,
+    0x00,
+    0x00,
+    0x00,
+    // code=101
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x3c,
+    0x46,
+    0x82,
+    0xfe,
+    0x80,
+    0x80,
+    0x42,
+    0x3c,
+    0x00,
+    0x00,
+    0x00,
+    // code=102
+    0x00,
+    0x00,
+    0x30,
+    0x40,
+    0x40,
+    0xf0,
+    0x40,
+    0x40,
+    0x40,
+    0x40,
+    0x40,
+    0x40,
+    0x40,
+    0x00,
+    0x00,
+    0x00,
+    // code=103
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x3a,
+    0x46,
+    0x82,
+    0x82,
+    0x82,
+    0x82,
+    0x46,
+    0x3a,
+    0x02,
+    0x46,
+    0x3c,
+    // code=104
+    0x00,
+    0x00,
+    0x80,
+    0x80,
+    0x80,
+    0xbc,
+    0xc6,
+    0x82,
+    0x82,
+    0x82,
+    0x82,
+    0x82,
+    0x82,
+    0x00,
+    0x00,
+    0x00,
+    // code=105
+    0x00,
+    0x00,
+    0x80,
+    0x80,
+    0x00,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x00,
+    0x00,
+    0x00,
+    // code=106
+    0x00,
+    0x00,
+    0x20,
+    0x20,
+    0x00,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0xc0,
+    // code=107
+    0x00,
+    0x00,
+    0x80,
+    0x80,
+    0x80,
+    0x84,
+    0x88,
+    0x90,
+    0xe0,
+    0xa0,
+    0x90,
+    0x88,
+    0x84,
+    0x00,
+    0x00,
+    0x00,
+    // code=108
+    0x00,
+    0x00,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x00,
+    0x00,
+    0x00,
+    // code=109
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0xb9, 0xc0,
+    0xc6, 0x20,
+    0x84, 0x20,
+    0x84, 0x20,
+    0x84, 0x20,
+    0x84, 0x20,
+    0x84, 0x20,
+    0x84, 0x20,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // code=110
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0xbc,
+    0xc6,
+    0x82,
+    0x82,
+    0x82,
+    0x82,
+    0x82,
+    0x82,
+    0x00,
+    0x00,
+    0x00,
+    // code=111
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x38,
+    0x44,
+    0x82,
+    0x82,
+    0x82,
+    0x82,
+    0x44,
+    0x38,
+    0x00,
+    0x00,
+    0x00,
+    // code=112
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0xb8,
+    0xc4,
+    0x82,
+    0x82,
+    0x82,
+    0x82,
+    0xc4,
+    0xb8,
+    0x80,
+    0x80,
+    0x80,
+    // code=113
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x3a,
+    0x46,
+    0x82,
+    0x82,
+    0x82,
+    0x82,
+    0x46,
+    0x3a,
+    0x02,
+    0x02,
+    0x02,
+    // code=114
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0xb0,
+    0xc0,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x00,
+    0x00,
+    0x00,
+    // code=115
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x78,
+    0x84,
+    0x80,
+    0xe0,
+    0x1c,
+    0x04,
+    0x84,
+    0x78,
+    0x00,
+    0x00,
+    0x00,
+    // code=116
+    0x00,
+    0x00,
+    0x00,
+    0x40,
+    0x40,
+    0xf8,
+    0x40,
+    0x40,
+    0x40,
+    0x40,
+    0x40,
+    0x40,
+    0x38,
+    0x00,
+    0x00,
+    0x00,
+    // code=117
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x82,
+    0x82,
+    0x82,
+    0x82,
+    0x82,
+    0x82,
+    0xc6,
+    0x7a,
+    0x00,
+    0x00,
+    0x00,
+    // code=118
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x82,
+    0x82,
+    0x44,
+    0x44,
+    0x44,
+    0x28,
+    0x28,
+    0x10,
+    0x00,
+    0x00,
+    0x00,
+    // code=119
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x88, 0x80,
+    0x88, 0x80,
+    0x88, 0x80,
+    0x55, 0x00,
+    0x55, 0x00,
+    0x55, 0x00,
+    0x22, 0x00,
+    0x22, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    // code=120
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x82,
+    0x44,
+    0x28,
+    0x10,
+    0x10,
+    0x28,
+    0x44,
+    0x82,
+    0x00,
+    0x00,
+    0x00,
+    // code=121
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x82,
+    0x82,
+    0x44,
+    0x44,
+    0x28,
+    0x28,
+    0x10,
+    0x10,
+    0x10,
+    0x20,
+    0xc0,
+    // code=122
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0xfc,
+    0x04,
+    0x08,
+    0x10,
+    0x20,
+    0x40,
+    0x80,
+    0xfc,
+    0x00,
+    0x00,
+    0x00,
+    // code=123
+    0x00,
+    0x00,
+    0x18,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0xc0,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x18,
+    0x00,
+    // code=124
+    0x00,
+    0x00,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    0x80,
+    // code=125
+    0x00,
+    0x00,
+    0xc0,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x18,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0x20,
+    0xc0,
+    0x00,
+    // code=126
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x78, 0x80,
+    0x8f, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00
+};
+
+static const FONT_GLYPH_T DEJAVU_F16_glyph_info[] = {
+    { 0, 1, 4, 0 },  // code=32
+    { 16, 1, 5, 2 },  // code=33
+    { 32, 3, 5, 1 },  // code=34
+    { 48, 10, 12, 1 },  // code=35
+    { 80, 7, 9, 1 },  // code=36
+    { 96, 12, 13, 0 },  // code=37
+    { 128, 10, 12, 1 },  // code=38
+    { 160, 1, 3, 1 },  // code=39
+    { 176, 3, 5, 1 },  // code=40
+    { 192, 3, 5, 1 },  // code=41
+    { 208, 7, 7, 0 },  // code=42
+    { 224, 9, 12, 1 },  // code=43
+    { 256, 2, 4, 1 },  // code=44
+    { 272, 4, 5, 1 },  // code=45
+    { 288, 1, 4, 2 },  // code=46
+    { 304, 5, 5, 0 },  // code=47
+    { 320, 7, 9, 1 },  // code=48
+    { 336, 5, 9, 2 },  // code=49
+    { 352, 6, 9, 1 },  // code=50
+    { 368, 7, 9, 1 },  // code=51
+    { 384, 7, 9, 1 },  // code=52
+    { 400, 7, 9, 1 },  // code=53
+    { 416, 7, 9, 1 },  // code=54
+    { 432, 7, 9, 1 },  // code=55
+    { 448, 7, 9, 1 },  // code=56
+    { 464, 7, 9, 1 },  // code=57
+    { 480, 1, 5, 2 },  // code=58
+    { 496, 2, 5, 1 },  // code=59
+    { 512, 9, 12, 1 },  // code=60
+    { 544, 9, 12, 1 },  // code=61
+    { 576, 9, 12, 1 },  // code=62
+    { 608, 5, 7, 1 },  // code=63
+    { 624, 12, 14, 1 },  // code=64
+    { 656, 9, 9, 0 },  // code=65
+    { 688, 8, 10, 1 },  // code=66
+    { 704, 8, 10, 1 },  // code=67
+    { 720, 9, 11, 1 },  // code=68
+    { 752, 7, 9, 1 },  // code=69
+    { 768, 6, 8, 1 },  // code=70
+    { 784, 9, 11, 1 },  // code=71
+    { 816, 8, 10, 1 },  // code=72
+    { 832, 1, 3, 1 },  // code=73
+    { 848, 3, 3, -1 },  // code=74
+    { 864, 8, 9, 1 },  // code=75
+    { 880, 6, 7, 1 },  // code=76
+    { 896, 10, 12, 1 },  // code=77
+    { 928, 8, 10, 1 },  // code=78
+    { 944, 9, 11, 1 },  // code=79
+    { 976, 7, 9, 1 },  // code=80
+    { 992, 9, 11, 1 },  // code=81
+    { 1024, 8, 10, 1 },  // code=82
+    { 1040, 7, 9, 1 },  // code=83
+    { 1056, 9, 9, 0 },  // code=84
+    { 1088, 8, 10, 1 },  // code=85
+    { 1104, 9, 9, 0 },  // code=86
+    { 1136, 13, 13, 0 },  // code=87
+    { 1168, 9, 9, 0 },  // code=88
+    { 1200, 9, 9, 0 },  // code=89
+    { 1232, 8, 10, 1 },  // code=90
+    { 1248, 3, 5, 1 },  // code=91
+    { 1264, 5, 5, 0 },  // code=92
+    { 1280, 3, 5, 1 },  // code=93
+    { 1296, 9, 12, 1 },  // code=94
+    { 1328, 7, 7, 0 },  // code=95
+    { 1344, 3, 7, 1 },  // code=96
+    { 1360, 6, 8, 1 },  // code=97
+    { 1376, 7, 9, 1 },  // code=98
+    { 1392, 6, 8, 1 },  // code=99
+    { 1408, 7, 9, 1 },  // code=100
+    { 1424, 7, 9, 1 },  // code=101
+    { 1440, 4, 4, 0 },  // code=102
+    { 1456, 7, 9, 1 },  // code=103
+    { 1472, 7, 9, 1 },  // code=104
+    { 1488, 1, 3, 1 },  // code=105
+    { 1504, 3, 3, -1 },  // code=106
+    { 1520, 7, 8, 1 },  // code=107
+    { 1536, 1, 3, 1 },  // code=108
+    { 1552, 11, 13, 1 },  // code=109
+    { 1584, 7, 9, 1 },  // code=110
+    { 1600, 7, 9, 1 },  // code=111
+    { 1616, 7, 9, 1 },  // code=112
+    { 1632, 7, 9, 1 },  // code=113
+    { 1648, 4, 5, 1 },  // code=114
+    { 1664, 6, 8, 1 },  // code=115
+    { 1680, 5, 5, 0 },  // code=116
+    { 1696, 7, 9, 1 },  // code=117
+    { 1712, 7, 7, 0 },  // code=118
+    { 1728, 9, 11, 1 },  // code=119
+    { 1760, 7, 7, 0 },  // code=120
+    { 1776, 7, 7, 0 },  // code=121
+    { 1792, 6, 8, 1 },  // code=122
+    { 1808, 5, 9, 2 },  // code=123
+    { 1824, 1, 5, 2 },  // code=124
+    { 1840, 5, 9, 3 },  // code=125
+    { 1856, 9, 12, 1 },  // code=126
+};
+
+static const FONT_KERN_T DEJAVU_F16_kern[] = {
+    { 45, 84, -1 },
+    { 45, 89, -1 },
+    { 65, 84, -1 },
+    { 65, 89, -1 },
+    { 65, 121, -1 },
+    { 70, 46, -1 },
+    { 70, 58, -1 },
+    { 70, 65, -1 },
+    { 70, 97, -1 },
+    { 70, 105, -1 },
+    { 70, 114, -1 },
+    { 70, 121, -1 },
+    { 75, 45, -1 },
+    { 75, 84, -1 },
+    { 75, 121, -1 },
+    { 76, 84, -1 },
+    { 76, 86, -1 },
+    { 76, 87, -1 },
+    { 76, 89, -1 },
+    { 76, 121, -1 },
+    { 80, 46, -1 },
+    { 82, 84, -1 },
+    { 84, 45, -1 },
+    { 84, 46, -1 },
+    { 84, 58, -1 },
+    { 84, 65, -1 },
+    { 84, 97, -1 },
+    { 84, 99, -1 },
+    { 84, 101, -1 },
+    { 84, 111, -1 },
+    { 84, 114, -1 },
+    { 84, 115, -1 },
+    { 84, 117, -1 },
+    { 84, 119, -1 },
+    { 84, 121, -1 },
+    { 86, 46, -1 },
+    { 86, 58, -1 },
+    { 86, 97, -1 },
+    { 86, 101, -1 },
+    { 86, 111, -1 },
+    { 86, 117, -1 },
+    { 87, 46, -1 },
+    { 88, 67, -1 },
+    { 89, 45, -1 },
+    { 89, 46, -2 },
+    { 89, 58, -1 },
+    { 89, 65, -1 },
+    { 89, 97, -1 },
+    { 89, 101, -1 },
+    { 89, 111, -1 },
+    { 89, 117, -1 },
+    { 102, 46, -1 },
+    { 114, 46, -1 },
+    { 118, 46, -1 },
+    { 119, 46, -1 },
+    { 121, 46, -1 },
+    { 121, 58, -1 },
+};
+
+#endif
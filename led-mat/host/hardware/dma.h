@@ -0,0 +1,8 @@
+// Nothing of it is used by the tcp server, see pico/stdlib.h
+
+#ifndef __HOST_HARDWARE_DMA_H
+#define __HOST_HARDWARE_DMA_H
+
+#include "pico/stdlib.h"
+
+#endif
@@ -0,0 +1,10 @@
+#ifndef __HOST_HARDWARE_FLASH_H
+#define __HOST_HARDWARE_FLASH_H
+
+#include "pico/stdlib.h"
+
+#define FLASH_UNIQUE_ID_SIZE_BYTES 8
+
+void flash_get_unique_id(uint8_t* id);
+
+#endif
@@ -0,0 +1,12 @@
+#ifndef __HOST_LWIP_IGMP_H
+#define __HOST_LWIP_IGMP_H
+
+#include "lwip/udp.h"
+
+#define IP4_ADDR_ANY4 ((const ip4_addr_t*)NULL)
+#define IP4_ADDR(ipaddr, a, b, c, d) ((ipaddr)->addr = ((u32_t)(a) << 24) | ((u32_t)(b) << 16) | ((u32_t)(c) << 8) | (u32_t)(d))
+
+static inline err_t igmp_joingroup(const ip4_addr_t* ifaddr, const ip4_addr_t* groupaddr) { return ERR_OK; }
+static inline err_t igmp_leavegroup(const ip4_addr_t* ifaddr, const ip4_addr_t* groupaddr) { return ERR_OK; }
+
+#endif
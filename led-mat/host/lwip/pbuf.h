@@ -0,0 +1,36 @@
+#ifndef __HOST_LWIP_PBUF_H
+#define __HOST_LWIP_PBUF_H
+
+#include "pico/stdlib.h"
+
+typedef uint8_t u8_t;
+typedef uint16_t u16_t;
+typedef uint32_t u32_t;
+typedef int8_t err_t;
+
+#define ERR_OK 0
+#define ERR_VAL -6
+#define ERR_ABRT -13
+
+#define IPADDR_TYPE_ANY 46
+
+typedef struct ip4_addr {
+    u32_t addr;
+} ip4_addr_t;
+typedef ip4_addr_t ip_addr_t;
+
+// A segment of a chain, tot_len counts it and the ones after it
+struct pbuf {
+    struct pbuf* next;
+    void* payload;
+    u16_t tot_len;
+    u16_t len;
+};
+
+u8_t pbuf_free(struct pbuf* p);
+
+// Only the datagram receivers copy out of pbufs, and no datagrams come in
+static inline u16_t pbuf_copy_partial(const struct pbuf* p, void* dataptr, u16_t len, u16_t offset) { return 0; }
+static inline void* pbuf_get_contiguous(const struct pbuf* p, void* buffer, size_t bufsize, u16_t len, u16_t offset) { return NULL; }
+
+#endif
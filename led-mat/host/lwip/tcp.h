@@ -0,0 +1,32 @@
+#ifndef __HOST_LWIP_TCP_H
+#define __HOST_LWIP_TCP_H
+
+#include "lwip/pbuf.h"
+
+#define TCP_WRITE_FLAG_COPY 0x01
+
+// Whatever the program wants to know about a connection
+struct tcp_pcb {
+    void* arg;
+    err_t (*accept)(void* arg, struct tcp_pcb* newpcb, err_t err);
+    err_t (*recv)(void* arg, struct tcp_pcb* tpcb, struct pbuf* p, err_t err);
+};
+
+struct tcp_pcb* tcp_new_ip_type(u8_t type);
+err_t tcp_bind(struct tcp_pcb* pcb, const ip_addr_t* ipaddr, u16_t port);
+struct tcp_pcb* tcp_listen_with_backlog(struct tcp_pcb* pcb, u8_t backlog);
+void tcp_arg(struct tcp_pcb* pcb, void* arg);
+void tcp_accept(struct tcp_pcb* pcb, err_t (*accept)(void* arg, struct tcp_pcb* newpcb, err_t err));
+void tcp_recv(struct tcp_pcb* pcb, err_t (*recv)(void* arg, struct tcp_pcb* tpcb, struct pbuf* p, err_t err));
+err_t tcp_write(struct tcp_pcb* pcb, const void* dataptr, u16_t len, u8_t apiflags);
+err_t tcp_close(struct tcp_pcb* pcb);
+void tcp_abort(struct tcp_pcb* pcb);
+
+// Nothing is sent or timed out
+static inline void tcp_sent(struct tcp_pcb* pcb, err_t (*sent)(void* arg, struct tcp_pcb* tpcb, u16_t len)) {}
+static inline void tcp_poll(struct tcp_pcb* pcb, err_t (*poll)(void* arg, struct tcp_pcb* tpcb), u8_t interval) {}
+static inline void tcp_err(struct tcp_pcb* pcb, void (*err)(void* arg, err_t err)) {}
+static inline err_t tcp_output(struct tcp_pcb* pcb) { return ERR_OK; }
+static inline void tcp_recved(struct tcp_pcb* pcb, u16_t len) {}
+
+#endif
@@ -0,0 +1,16 @@
+#ifndef __HOST_LWIP_UDP_H
+#define __HOST_LWIP_UDP_H
+
+#include "lwip/pbuf.h"
+
+struct udp_pcb;
+
+typedef void (*udp_recv_fn)(void* arg, struct udp_pcb* pcb, struct pbuf* p, const ip_addr_t* addr, u16_t port);
+
+// No datagrams come in, the server runs without the stream and DMX receivers
+static inline struct udp_pcb* udp_new_ip_type(u8_t type) { return NULL; }
+static inline err_t udp_bind(struct udp_pcb* pcb, const ip_addr_t* ipaddr, u16_t port) { return ERR_VAL; }
+static inline void udp_recv(struct udp_pcb* pcb, udp_recv_fn recv, void* recv_arg) {}
+static inline void udp_remove(struct udp_pcb* pcb) {}
+
+#endif
@@ -0,0 +1,20 @@
+#ifndef __HOST_PICO_CYW43_ARCH_H
+#define __HOST_PICO_CYW43_ARCH_H
+
+#include "pico/stdlib.h"
+
+#define CYW43_AUTH_WPA2_AES_PSK 0x00400004
+
+// There's no radio, the server never gets past tcp_server_init on the host
+static inline int cyw43_arch_init() { return -1; }
+static inline void cyw43_arch_deinit() {}
+static inline void cyw43_arch_set_hostname(const char* hostname) {}
+static inline void cyw43_arch_enable_sta_mode() {}
+static inline int cyw43_arch_wifi_connect_timeout_ms(const char* ssid, const char* pw, uint32_t auth, uint32_t timeout) { return -1; }
+
+// lwIP runs on the calling thread
+static inline void cyw43_arch_lwip_check() {}
+static inline void cyw43_arch_lwip_begin() {}
+static inline void cyw43_arch_lwip_end() {}
+
+#endif
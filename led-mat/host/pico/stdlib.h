@@ -0,0 +1,14 @@
+// Stand-ins for the Pico SDK and lwIP headers led-mat.h includes, so the tcp server builds on the
+// host. Only what led-server.c uses is here, the calls that reach lwIP are left to the program.
+
+#ifndef __HOST_PICO_STDLIB_H
+#define __HOST_PICO_STDLIB_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#endif
@@ -0,0 +1,284 @@
+// Converter from BDF bitmap fonts to proportional fonts for the compositor
+// Writes a header with the glyphs, their metrics and kerning pairs, to be included from font.c,
+// and prints the FONT_T that goes with it
+// The kerning file is optional, with a pair per line: left right offset, where the characters
+// are either themselves or their codes, e.g. "A V -1" or "0x54 0x6f -1"
+// Anti-aliased fonts come from drawing the BDF font scale times larger than it's wanted, each
+// scale x scale block becoming a pixel with 2 or 4 bits of coverage; kerning is after scaling
+// usage: led-bdf [-b bits per pixel] [-s scale] name input.bdf output.h [kerning]
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "font.h"
+
+#define BDF_MAX_GLYPHS 256
+#define BDF_MAX_KERN 1024
+#define BDF_MAX_SIZE 255
+
+typedef struct BDF_GLYPH_T_ {
+    bool present;
+    int32_t width;
+    int32_t height;
+    int32_t x;
+    int32_t y;
+    int32_t advance;
+    uint8_t* rows;  // height rows of (width + 7) / 8 bytes, top down
+    int32_t bearing;  // scaled down
+    int32_t out_width;
+    int32_t out_advance;
+} BDF_GLYPH_T;
+
+static BDF_GLYPH_T bdf_glyph[BDF_MAX_GLYPHS];
+static FONT_KERN_T bdf_kern[BDF_MAX_KERN];
+static uint32_t bdf_bpp = 1;
+static int32_t bdf_scale = 1;
+
+static int32_t bdf_floor_div(int32_t a, int32_t b)
+{
+    return (a >= 0) ? a / b : -((-a + b - 1) / b);
+}
+
+// Coverage of a pixel of the scaled down glyph, from the share of its scale x scale block that's set
+// top is the row of the cell, before scaling, the glyph's bitmap starts at
+static uint32_t bdf_level(const BDF_GLYPH_T* glyph, int32_t top, int32_t row, int32_t col)
+{
+    int32_t row_bytes = (glyph->width + 7) >> 3;
+    int32_t left = glyph->x - glyph->bearing * bdf_scale;
+    int32_t levels = (1 << bdf_bpp) - 1;
+    int32_t count = 0;
+    int32_t dx, dy, gr, gc;
+
+    if (col >= glyph->out_width) return 0;
+    for (dy = 0; dy < bdf_scale; dy++) {
+        for (dx = 0; dx < bdf_scale; dx++) {
+            gr = row * bdf_scale + dy - top;
+            gc = col * bdf_scale + dx - left;
+            if (gr < 0 || gr >= glyph->height || gc < 0 || gc >= glyph->width) continue;
+            if (glyph->rows[gr * row_bytes + (gc >> 3)] & (0x80 >> (gc & 0x7))) count++;
+        }
+    }
+    return (count * levels + bdf_scale * bdf_scale / 2) / (bdf_scale * bdf_scale);
+}
+
+static int32_t bdf_char(const char* s)
+{
+    if (strlen(s) == 1 && !isdigit((unsigned char)s[0])) return (unsigned char)s[0];
+    return strtol(s, NULL, 0);
+}
+
+static int bdf_kern_cmp(const void* a, const void* b)
+{
+    const FONT_KERN_T* ka = a;
+    const FONT_KERN_T* kb = b;
+    return ((ka->left << 8) | ka->right) - ((kb->left << 8) | kb->right);
+}
+
+static uint32_t bdf_read_kern(const char* name)
+{
+    FILE* file = fopen(name, "r");
+    char line[256], left[32], right[32];
+    int32_t offset, l, r;
+    uint32_t n = 0;
+
+    if (!file) {
+        printf("can't open %s\n", name);
+        exit(1);
+    }
+    while (fgets(line, sizeof(line), file)) {
+        if (sscanf(line, "%31s %31s %d", left, right, &offset) != 3 || left[0] == '#') continue;
+        l = bdf_char(left);
+        r = bdf_char(right);
+        if (l < 0 || l >= BDF_MAX_GLYPHS || r < 0 || r >= BDF_MAX_GLYPHS || offset < -128 || offset > 127) {
+            printf("bad kerning pair: %s", line);
+            continue;
+        }
+        if (n == BDF_MAX_KERN) {
+            printf("only the first %d kerning pairs are kept\n", BDF_MAX_KERN);
+            break;
+        }
+        bdf_kern[n].left = l;
+        bdf_kern[n].right = r;
+        bdf_kern[n].offset = offset;
+        n++;
+    }
+    fclose(file);
+    qsort(bdf_kern, n, sizeof(FONT_KERN_T), bdf_kern_cmp);
+    return n;
+}
+
+int main(int argc, char** argv)
+{
+    FILE* file;
+    char line[1024];
+    BDF_GLYPH_T* glyph = NULL;
+    BDF_GLYPH_T cur;
+    int32_t ascent = -1;
+    int32_t descent = -1;
+    int32_t box_height = 0;
+    int32_t box_y = 0;
+    int32_t encoding = -1;
+    int32_t advance = 0;
+    int32_t height, first = -1, last = -1;
+    int32_t a, c, r, b, x, pad, row_bytes, max_advance = 0;
+    uint32_t offset = 0;
+    uint32_t num_kern = 0;
+    uint32_t k;
+    int32_t bitmap_row = -1;
+    unsigned int value;
+
+    for (a = 1; a + 1 < argc && argv[a][0] == '-'; a += 2) {
+        if (strcmp(argv[a], "-b") == 0) bdf_bpp = strtoul(argv[a + 1], NULL, 0);
+        if (strcmp(argv[a], "-s") == 0) bdf_scale = strtoul(argv[a + 1], NULL, 0);
+    }
+    if ((argc != a + 3 && argc != a + 4) || (bdf_bpp != 1 && bdf_bpp != 2 && bdf_bpp != 4) || bdf_scale < 1) {
+        printf("usage: %s [-b 1|2|4] [-s scale] name input.bdf output.h [kerning]\n", argv[0]);
+        return 1;
+    }
+
+    file = fopen(argv[a + 1], "r");
+    if (!file) {
+        printf("can't open %s\n", argv[a + 1]);
+        return 1;
+    }
+    memset(&cur, 0, sizeof(cur));
+    while (fgets(line, sizeof(line), file)) {
+        if (bitmap_row >= 0) {
+            if (strncmp(line, "ENDCHAR", 7) == 0) {
+                if (glyph) {
+                    *glyph = cur;
+                } else {
+                    free(cur.rows);
+                }
+                bitmap_row = -1;
+                continue;
+            }
+            if (bitmap_row < cur.height) {
+                row_bytes = (cur.width + 7) >> 3;
+                for (b = 0; b < row_bytes && sscanf(line + 2 * b, "%2x", &value) == 1; b++) {
+                    cur.rows[bitmap_row * row_bytes + b] = value;
+                }
+            }
+            bitmap_row++;
+            continue;
+        }
+        if (sscanf(line, "FONTBOUNDINGBOX %*d %d %*d %d", &box_height, &box_y) == 2) continue;
+        if (sscanf(line, "FONT_ASCENT %d", &ascent) == 1) continue;
+        if (sscanf(line, "FONT_DESCENT %d", &descent) == 1) continue;
+        if (sscanf(line, "ENCODING %d", &encoding) == 1) continue;
+        if (sscanf(line, "DWIDTH %d", &advance) == 1) continue;
+        if (sscanf(line, "BBX %d %d %d %d", &cur.width, &cur.height, &cur.x, &cur.y) == 4) continue;
+        if (strncmp(line, "BITMAP", 6) == 0) {
+            // only 8 bit characters are kept
+            if (encoding < 0 || encoding >= BDF_MAX_GLYPHS) {
+                glyph = NULL;
+            } else {
+                glyph = &bdf_glyph[encoding];
+            }
+            cur.advance = advance;
+            cur.present = true;
+            cur.rows = calloc(cur.height * ((cur.width + 7) >> 3) + 1, 1);
+            bitmap_row = 0;
+            continue;
+        }
+        if (strncmp(line, "STARTCHAR", 9) == 0) {
+            encoding = -1;
+            advance = 0;
+            memset(&cur, 0, sizeof(cur));
+            continue;
+        }
+        if (strncmp(line, "ENDFONT", 7) == 0) break;
+    }
+    fclose(file);
+
+    if (ascent < 0 || descent < 0) {
+        ascent = box_height + box_y;
+        descent = -box_y;
+    }
+    // the baseline stays on a pixel boundary when scaling down
+    pad = (bdf_scale - ascent % bdf_scale) % bdf_scale;
+    height = (pad + ascent + descent + bdf_scale - 1) / bdf_scale;
+    if (height <= 0 || height > BDF_MAX_SIZE) {
+        printf("%s has no usable font height\n", argv[a + 1]);
+        return 1;
+    }
+    for (c = 0; c < BDF_MAX_GLYPHS; c++) {
+        glyph = &bdf_glyph[c];
+        if (!glyph->present) continue;
+        if (first < 0) first = c;
+        last = c;
+        glyph->bearing = bdf_floor_div(glyph->x, bdf_scale);
+        glyph->out_width = glyph->width ? (glyph->x - glyph->bearing * bdf_scale + glyph->width + bdf_scale - 1) / bdf_scale : 0;
+        glyph->out_advance = (glyph->advance + bdf_scale / 2) / bdf_scale;
+        if (glyph->out_advance > max_advance) max_advance = glyph->out_advance;
+        if (glyph->out_width > BDF_MAX_SIZE || glyph->bearing < -128 || glyph->bearing > 127) {
+            printf("character %d is too wide\n", c);
+            return 1;
+        }
+    }
+    if (first < 0) {
+        printf("%s has no glyphs for characters 0 to %d\n", argv[a + 1], BDF_MAX_GLYPHS - 1);
+        return 1;
+    }
+    if (max_advance > BDF_MAX_SIZE) {
+        printf("%s has glyphs wider than %d\n", argv[a + 1], BDF_MAX_SIZE);
+        return 1;
+    }
+    if (argc == a + 4) num_kern = bdf_read_kern(argv[a + 3]);
+
+    file = fopen(argv[a + 2], "w");
+    if (!file) {
+        printf("can't write %s\n", argv[a + 2]);
+        return 1;
+    }
+    fprintf(file, "// %s, converted from %s by led-bdf\n\n", argv[a], argv[a + 1]);
+    fprintf(file, "#ifndef __%s_H\n#define __%s_H\n\n", argv[a], argv[a]);
+
+    // every glyph gets the full height of the font, so the baselines line up
+    fprintf(file, "static const uint8_t %s_glyphs[] = {\n", argv[a]);
+    for (c = first; c <= last; c++) {
+        glyph = &bdf_glyph[c];
+        row_bytes = (glyph->out_width * bdf_bpp + 7) >> 3;
+        if (!glyph->present || row_bytes == 0) continue;
+        fprintf(file, "    // code=%d\n", c);
+        for (r = 0; r < height; r++) {
+            fprintf(file, "   ");
+            for (b = 0; b < row_bytes; b++) {
+                value = 0;
+                for (x = 0; x < 8; x += bdf_bpp) {
+                    value = (value << bdf_bpp) | bdf_level(glyph, pad + ascent - glyph->y - glyph->height, r, (8 * b + x) / bdf_bpp);
+                }
+                fprintf(file, " 0x%02x,", value);
+            }
+            fprintf(file, "\n");
+        }
+    }
+    // keeps the array from being empty when no glyph has any pixels
+    fprintf(file, "    0x00\n};\n\n");
+
+    fprintf(file, "static const FONT_GLYPH_T %s_glyph_info[] = {\n", argv[a]);
+    for (c = first; c <= last; c++) {
+        glyph = &bdf_glyph[c];
+        fprintf(file, "    { %lu, %d, %d, %d },  // code=%d\n", (unsigned long)offset,
+            glyph->out_width, glyph->out_advance, glyph->bearing, c);
+        if (glyph->present) offset += ((glyph->out_width * bdf_bpp + 7) >> 3) * height;
+    }
+    fprintf(file, "};\n\n");
+
+    if (num_kern) {
+        fprintf(file, "static const FONT_KERN_T %s_kern[] = {\n", argv[a]);
+        for (k = 0; k < num_kern; k++) {
+            fprintf(file, "    { %d, %d, %d },\n", bdf_kern[k].left, bdf_kern[k].right, bdf_kern[k].offset);
+        }
+        fprintf(file, "};\n\n");
+    }
+    fprintf(file, "#endif\n");
+    fclose(file);
+
+    printf("const FONT_T %s = { %d, %d, 0, %d, %s_glyphs, %s_glyph_info, %d, %s%s, %lu, %d };\n",
+        argv[a], max_advance, height, first, argv[a], argv[a], last - first + 1,
+        num_kern ? argv[a] : "NULL", num_kern ? "_kern" : "", (unsigned long)num_kern, bdf_bpp);
+    return 0;
+}
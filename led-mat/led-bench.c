@@ -0,0 +1,445 @@
+// Compositor benchmark for the host
+// Renders a few representative scenes and reports the time spent in each stage
+// usage: led-bench [frames] [bits per component] [dither]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "led-render.h"
+#include "led-encode.h"
+
+extern SCAN_FRAME_T scan_frame[SCAN_NUM_FRAMES];
+extern RENDER_STATS_T render_stats;
+
+#define BENCH_IMAGE_HEIGHT (2 * LED_PANEL_HEIGHT)
+
+static uint32_t bench_image[BENCH_IMAGE_HEIGHT * LED_PANEL_WIDTH / 2];
+static uint16_t bench_palette[256];
+
+// Frames where a band of the bench image moves down over solid rows, a few rows changing each time
+#define BENCH_MOVIE_FRAMES 16
+#define BENCH_MOVIE_SIZE (BENCH_MOVIE_FRAMES * LED_PANEL_HEIGHT * LED_PANEL_WIDTH)
+static uint16_t bench_movie[BENCH_MOVIE_SIZE];
+// A ball, transparent around it
+#define BENCH_SPRITE_SIZE 16
+static uint16_t bench_sprite[BENCH_SPRITE_SIZE * BENCH_SPRITE_SIZE];
+
+// A world 4 panels wide and high, built from 16 tiles of 8x8
+#define BENCH_TILE_SIZE 8
+#define BENCH_NUM_TILES 16
+#define BENCH_MAP_WIDTH (4 * LED_PANEL_WIDTH / BENCH_TILE_SIZE)
+#define BENCH_MAP_HEIGHT (4 * LED_PANEL_HEIGHT / BENCH_TILE_SIZE)
+static uint16_t bench_tiles[BENCH_NUM_TILES * BENCH_TILE_SIZE * BENCH_TILE_SIZE];
+static uint16_t bench_map[BENCH_MAP_WIDTH * BENCH_MAP_HEIGHT];
+
+// The console font with each glyph trimmed to its pixels, and a few kerning pairs
+static uint8_t bench_prop_glyphs[256 * 8];
+static FONT_GLYPH_T bench_prop_glyph_info[256];
+static const FONT_KERN_T bench_prop_kern[] = {
+    { 'T', 'h', -1 }, { 'f', 'o', -1 }, { 'l', 'a', -1 }, { 'o', 'v', -1 }, { 'y', ' ', -1 }
+};
+static const FONT_T bench_prop_font = {
+    6, 8, 0, 0, bench_prop_glyphs, bench_prop_glyph_info, 256, bench_prop_kern, sizeof(bench_prop_kern) / sizeof(FONT_KERN_T)
+};
+// The same, at 4 bits per pixel with a faint edge next to each pixel
+static uint8_t bench_aa_glyphs[256 * 8 * 5];
+static FONT_GLYPH_T bench_aa_glyph_info[256];
+static const FONT_T bench_aa_font = {
+    6, 8, 0, 0, bench_aa_glyphs, bench_aa_glyph_info, 256, bench_prop_kern, sizeof(bench_prop_kern) / sizeof(FONT_KERN_T), 4
+};
+
+static uint32_t bench_movie_rle[BENCH_MOVIE_SIZE / 2 + 4 * BENCH_MOVIE_FRAMES * (LED_PANEL_HEIGHT + 1)];
+static bool bench_dither = false;
+
+// Simulated time, a refresh period per frame, which keeps running across scenes
+static uint64_t bench_time_us = 0;
+static const char bench_text[] = "The quick brown fox jumps over the lazy dog 0123456789";
+
+typedef struct BENCH_STATS_T_ {
+    uint64_t anim_ns;
+    uint64_t update_ns;
+    uint64_t compose_ns;
+    uint32_t composed;
+} BENCH_STATS_T;
+
+static uint64_t bench_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+// Colored bars, so each column and row encodes differently
+static void bench_init_image()
+{
+    uint32_t r, c, p0, p1;
+    for (r = 0; r < BENCH_IMAGE_HEIGHT; r++) {
+        for (c = 0; c < LED_PANEL_WIDTH / 2; c++) {
+            p0 = ((c & 0x1f) << 11) | ((r & 0x3f) << 5) | ((c + r) & 0x1f);
+            p1 = ((r & 0x1f) << 11) | ((c & 0x3f) << 5) | ((c ^ r) & 0x1f);
+            bench_image[r * (LED_PANEL_WIDTH / 2) + c] = p0 | (p1 << 16);
+        }
+    }
+    for (r = 0; r < BENCH_SPRITE_SIZE; r++) {
+        for (c = 0; c < BENCH_SPRITE_SIZE; c++) {
+            int32_t dx = 2 * c + 1 - BENCH_SPRITE_SIZE;
+            int32_t dy = 2 * r + 1 - BENCH_SPRITE_SIZE;
+            bool inside = dx * dx + dy * dy <= BENCH_SPRITE_SIZE * BENCH_SPRITE_SIZE;
+            bench_sprite[r * BENCH_SPRITE_SIZE + c] = inside ? 0xffe0 - (r << 11) : NO_BACKGROUND;
+        }
+    }
+    for (c = 0; c < BENCH_NUM_TILES * BENCH_TILE_SIZE * BENCH_TILE_SIZE; c++) {
+        bench_tiles[c] = ((const uint16_t*)bench_image)[c * 7];
+    }
+    for (c = 0; c < BENCH_MAP_WIDTH * BENCH_MAP_HEIGHT; c++) {
+        bench_map[c] = (c * 3 + c / BENCH_MAP_WIDTH * 5) % BENCH_NUM_TILES;
+    }
+    for (c = 0; c < 256; c++) {
+        bench_palette[c] = ((c & 0x1f) << 11) | (((c * 7) & 0x3f) << 5) | ((c >> 3) & 0x1f);
+    }
+}
+
+static void bench_init_prop_font()
+{
+    const FONT_T* f = font[FONT_ID_CONSOLE_5X8];
+    uint32_t c, r, x, level;
+    uint32_t offset = 0;
+    uint8_t ink, first, width;
+
+    for (c = 0; c < 256; c++) {
+        ink = 0;
+        for (r = 0; r < f->height; r++) {
+            ink |= f->glyphs[c * f->stride + r];
+        }
+        for (first = 0; first < 8 && !(ink & (0x80 >> first)); first++);
+        for (width = 8 - first; width > 0 && !(ink & (0x100 >> (first + width))); width--);
+        for (r = 0; r < f->height; r++) {
+            bench_prop_glyphs[c * f->height + r] = f->glyphs[c * f->stride + r] << first;
+        }
+        bench_prop_glyph_info[c].offset = c * f->height;
+        bench_prop_glyph_info[c].width = width;
+        bench_prop_glyph_info[c].advance = width ? width + 1 : 3;
+        bench_prop_glyph_info[c].bearing = 0;
+    }
+
+    // a column more on each side for the edges, packed as the glyph info says
+    for (c = 0; c < 256; c++) {
+        width = bench_prop_glyph_info[c].width ? bench_prop_glyph_info[c].width + 2 : 0;
+        bench_aa_glyph_info[c] = bench_prop_glyph_info[c];
+        bench_aa_glyph_info[c].offset = offset;
+        bench_aa_glyph_info[c].width = width;
+        bench_aa_glyph_info[c].bearing = -1;
+        for (r = 0; r < f->height; r++) {
+            uint32_t bits = bench_prop_glyphs[c * f->height + r] << 1;
+            uint32_t edge = (bits >> 1) | (bits << 1);
+            for (x = 0; x < width; x++) {
+                level = (bits & (0x100 >> x)) ? 0xf : (edge & (0x100 >> x)) ? 0x5 : 0;
+                bench_aa_glyphs[offset + (x >> 1)] |= level << ((x & 0x1) ? 0 : 4);
+            }
+            offset += (width + 1) >> 1;
+        }
+    }
+}
+
+static void bench_init_movie()
+{
+    uint32_t f, r, c;
+    uint16_t* pixel = bench_movie;
+    const uint16_t* image = (const uint16_t*)bench_image;
+    size_t size;
+
+    for (f = 0; f < BENCH_MOVIE_FRAMES; f++) {
+        for (r = 0; r < LED_PANEL_HEIGHT; r++) {
+            for (c = 0; c < LED_PANEL_WIDTH; c++) {
+                if ((r >> 2) == f) {
+                    *pixel++ = image[r * LED_PANEL_WIDTH + c];
+                } else {
+                    *pixel++ = (c < LED_PANEL_WIDTH / 2) ? (r << 11) : (r << 5);
+                }
+            }
+        }
+    }
+    size = rle_encode((uint8_t*)bench_movie_rle, sizeof(bench_movie_rle), bench_movie, LED_PANEL_WIDTH, LED_PANEL_HEIGHT, BENCH_MOVIE_FRAMES);
+    printf("movie of %d frames, raw %lu bytes, run-length coded %lu bytes\n", BENCH_MOVIE_FRAMES,
+        (unsigned long)sizeof(bench_movie), (unsigned long)size);
+}
+
+static void bench_init_anim(ANIM_T* anim, const void* src_data, int16_t width, int16_t pitch, int16_t height, int16_t delta_x)
+{
+    memset(anim, 0, sizeof(ANIM_T));
+    anim->width = width;
+    anim->pitch = pitch;
+    anim->height = height;
+    anim->src_data.start_value = src_data;
+    anim->x.delta = delta_x;
+    anim->x.num_frames = 1;
+    anim->num_frames = 10000;
+}
+
+static void bench_init_layer(LAYER_T* layer, const FONT_T* text_font, int16_t y, int16_t speed)
+{
+    int16_t len = strlen(bench_text);
+    layer->enable = true;
+    layer->box.src_data = bench_text;
+    layer->box.font = text_font;
+    layer->box.src_width = len;
+    layer->box.src_height = 1;
+    layer->box.x = 0;
+    layer->box.y = y;
+    layer->box.width = LED_PANEL_WIDTH;
+    layer->box.height = text_font->height;
+    layer->box.fg_color = 0xffff;
+    layer->box.bg_color = NO_BACKGROUND;
+    layer->box.opacity = MAX_OPACITY;
+    layer->anim.num_anim = 1;
+    bench_init_anim(&layer->anim.anim[0], bench_text, len, len, 1, speed);
+}
+
+// The bench image as a full panel layer, read as ARGB4444 its alpha varies over the panel
+static void bench_init_image_layer(LAYER_T* layer, uint8_t format, uint8_t opacity)
+{
+    memset(layer, 0, sizeof(LAYER_T));
+    layer->enable = true;
+    layer->box.src_data = (const char*)bench_image;
+    layer->box.src_width = LED_PANEL_WIDTH;
+    layer->box.src_height = LED_PANEL_HEIGHT;
+    layer->box.width = LED_PANEL_WIDTH;
+    layer->box.height = LED_PANEL_HEIGHT;
+    layer->box.format = format;
+    layer->box.opacity = opacity;
+    layer->anim.num_anim = 1;
+    bench_init_anim(&layer->anim.anim[0], bench_image, LED_PANEL_WIDTH, LED_PANEL_WIDTH, LED_PANEL_HEIGHT, 0);
+}
+
+static void bench_init_state(ANIM_SAVE_STATE_T* state, bool scroll_backdrop, const FONT_T* text_font, uint32_t num_layers)
+{
+    uint32_t l;
+
+    memset(state, 0, sizeof(ANIM_SAVE_STATE_T));
+    state->signature = ANIM_SIG;
+    state->brightness = MAX_BRIGHTNESS / 2;
+    state->dither = bench_dither;
+    state->backdrop.src_data = bench_image;
+    state->backdrop.width = LED_PANEL_WIDTH;
+    state->backdrop.pitch = LED_PANEL_WIDTH / 2;
+    state->backdrop.height = BENCH_IMAGE_HEIGHT;
+
+    if (scroll_backdrop) {
+        state->back_anim.num_anim = 1;
+        bench_init_anim(&state->back_anim.anim[0], bench_image, LED_PANEL_WIDTH, LED_PANEL_WIDTH / 2, BENCH_IMAGE_HEIGHT, -1);
+    }
+
+    // Tickers spread over the panel, overlapping once there are more than fit
+    for (l = 0; l < num_layers; l++) {
+        int16_t y = (l * (LED_PANEL_HEIGHT - text_font->height)) / ((num_layers > 1) ? num_layers - 1 : 2);
+        bench_init_layer(&state->layer[l], text_font, y, 1 + (l & 1));
+    }
+}
+
+// The movie as a backdrop animation, a frame per tick
+static void bench_init_movie_state(ANIM_SAVE_STATE_T* state, uint8_t format)
+{
+    ANIM_T* anim = &state->back_anim.anim[0];
+
+    bench_init_state(state, false, NULL, 0);
+    state->back_anim.num_anim = 1;
+    bench_init_anim(anim, bench_movie, LED_PANEL_WIDTH, LED_PANEL_WIDTH / 2, LED_PANEL_HEIGHT, 0);
+    anim->src_data.delta = LED_PANEL_WIDTH * LED_PANEL_HEIGHT * 2;
+    anim->src_data.iterations_until_restart = BENCH_MOVIE_FRAMES;
+    if (format == IMG_FORMAT_RLE) {
+        anim->src_data.start_value = (const char*)bench_movie_rle;
+        anim->src_data.delta = 4;
+    }
+    anim->format = format;
+}
+
+// Sprites on the same rows, moving sideways, so every one of them is drawn on each of their rows
+static void bench_init_sprites(ANIM_SAVE_STATE_T* state, uint32_t num_sprites)
+{
+    uint32_t i;
+
+    bench_init_state(state, true, NULL, 0);
+    for (i = 0; i < num_sprites; i++) {
+        SPRITE_T* sprite = &state->sprite[i];
+        sprite->enable = true;
+        sprite->flags = (i & 1) ? SPRITE_FLIP_X : 0;
+        sprite->width = BENCH_SPRITE_SIZE;
+        sprite->height = BENCH_SPRITE_SIZE;
+        sprite->anim.num_anim = 1;
+        bench_init_anim(&sprite->anim.anim[0], bench_sprite, BENCH_SPRITE_SIZE, BENCH_SPRITE_SIZE, BENCH_SPRITE_SIZE, 1);
+        sprite->anim.anim[0].x.start_value = i * (LED_PANEL_WIDTH / MAX_ROW_SPRITES);
+        sprite->anim.anim[0].y.start_value = (i / MAX_ROW_SPRITES) * BENCH_SPRITE_SIZE;
+    }
+}
+
+static void bench_run(const char* name, ANIM_SAVE_STATE_T* state, uint32_t num_frames)
+{
+    BENCH_STATS_T stats = { 0 };
+    uint32_t n;
+    uint64_t t0, t1, t2, t3;
+    uint32_t rows = render_stats.rows;
+
+    render_invalidate();
+    for (n = 0; n < num_frames; n++) {
+        t0 = bench_ns();
+        bench_time_us += LED_REFRESH_PERIOD_USEC;
+        anim_update(state, bench_time_us, true, ALL_LAYERS, ALL_SPRITES);
+        t1 = bench_ns();
+        bool pending = render_update(state);
+        t2 = bench_ns();
+        if (pending) {
+            compose_frame(&scan_frame[stats.composed % SCAN_NUM_FRAMES], state);
+            stats.composed++;
+        }
+        t3 = bench_ns();
+        stats.anim_ns += t1 - t0;
+        stats.update_ns += t2 - t1;
+        stats.compose_ns += t3 - t2;
+    }
+
+    uint64_t total_ns = stats.anim_ns + stats.update_ns + stats.compose_ns;
+    rows = render_stats.rows - rows;
+    printf("%-20s %10.0f fps  anim %7.2f us  update %7.2f us  compose %7.2f us  rows/frame %5.2f  %5.3f us/row\n", name,
+        total_ns ? 1e9 * num_frames / total_ns : 0.0,
+        stats.anim_ns / 1e3 / num_frames,
+        stats.update_ns / 1e3 / num_frames,
+        stats.compose_ns / 1e3 / num_frames,
+        (double)rows / num_frames,
+        rows ? stats.compose_ns / 1e3 / rows : 0.0);
+}
+
+int main(int argc, char** argv)
+{
+    ANIM_SAVE_STATE_T state;
+    uint32_t num_frames = (argc > 1) ? strtoul(argv[1], NULL, 0) : 10000;
+    uint32_t bpc = (argc > 2) ? strtoul(argv[2], NULL, 0) : LED_MIN_BPC;
+    bench_dither = (argc > 3) ? strtoul(argv[3], NULL, 0) != 0 : false;
+    char name[32];
+    int i;
+
+    if (bpc < LED_MIN_BPC || bpc > LED_MAX_BPC) {
+        printf("bits per component must be %d to %d\n", LED_MIN_BPC, LED_MAX_BPC);
+        return 1;
+    }
+
+    bench_init_image();
+    bench_init_movie();
+    bench_init_prop_font();
+    render_set_bpc(bpc);
+
+    bench_init_state(&state, false, NULL, 0);
+    bench_run("static backdrop", &state, num_frames);
+
+    bench_init_state(&state, true, NULL, 0);
+    bench_run("scrolling backdrop", &state, num_frames);
+
+    for (i = 0; i < MAX_FONT; i++) {
+        if (!font[i]) continue;
+        sprintf(name, "scrolling text %d", i);
+        bench_init_state(&state, false, font[i], 1);
+        bench_run(name, &state, num_frames);
+    }
+
+    // Cost of each extra layer, over a scrolling backdrop
+    for (i = 1; i <= MAX_LAYERS; i++) {
+        sprintf(name, "%d layers", i);
+        bench_init_state(&state, true, font[FONT_ID_CONSOLE_5X8], i);
+        bench_run(name, &state, num_frames);
+    }
+
+    // Palette backdrops, reading the bench image as indices
+    for (i = IMG_FORMAT_PAL8; i <= IMG_FORMAT_PAL2; i++) {
+        uint8_t bits = img_format_bits(i);
+        sprintf(name, "%d bit palette", bits);
+        bench_init_state(&state, true, NULL, 0);
+        state.backdrop.format = i;
+        state.backdrop.palette = bench_palette;
+        state.backdrop.pitch = LED_PANEL_WIDTH * bits / 32;
+        state.back_anim.anim[0].pitch = state.backdrop.pitch;
+        state.back_anim.anim[0].format = i;
+        state.back_anim.anim[0].palette = bench_palette;
+        bench_run(name, &state, num_frames);
+    }
+
+    // Decoding run-length coded frames against reading them raw
+    bench_init_movie_state(&state, IMG_FORMAT_RGB565);
+    bench_run("raw movie", &state, num_frames);
+    bench_init_movie_state(&state, IMG_FORMAT_RLE);
+    bench_run("run-length movie", &state, num_frames);
+
+    // A narrow box, where most columns of the panel are outside it
+    bench_init_state(&state, true, font[FONT_ID_CONSOLE_5X8], 1);
+    state.layer[0].box.x = LED_PANEL_WIDTH / 2 - 10;
+    state.layer[0].box.width = 20;
+    bench_run("narrow text", &state, num_frames);
+    bench_init_image_layer(&state.layer[0], IMG_FORMAT_RGB565, MAX_OPACITY);
+    state.layer[0].box.x = LED_PANEL_WIDTH / 2 - 10;
+    state.layer[0].box.width = 20;
+    bench_run("narrow image", &state, num_frames);
+    state.layer[0].box.opacity = MAX_OPACITY / 2;
+    bench_run("narrow translucent", &state, num_frames);
+
+    // Scrolling diagonally over a tilemap
+    bench_init_state(&state, true, NULL, 0);
+    state.back_anim.anim[0].src_data.start_value = (const char*)bench_map;
+    state.back_anim.anim[0].width = BENCH_MAP_WIDTH * BENCH_TILE_SIZE;
+    state.back_anim.anim[0].pitch = BENCH_MAP_WIDTH / 2;
+    state.back_anim.anim[0].height = BENCH_MAP_HEIGHT * BENCH_TILE_SIZE;
+    state.back_anim.anim[0].y.delta = 1;
+    state.back_anim.anim[0].y.num_frames = 1;
+    state.back_anim.anim[0].format = IMG_FORMAT_TILES8;
+    state.back_anim.anim[0].tiles = bench_tiles;
+    printf("tilemap of %dx%d, %lu bytes instead of %lu\n", BENCH_MAP_WIDTH * BENCH_TILE_SIZE, BENCH_MAP_HEIGHT * BENCH_TILE_SIZE,
+        (unsigned long)(sizeof(bench_map) + sizeof(bench_tiles)), (unsigned long)BENCH_MAP_WIDTH * BENCH_MAP_HEIGHT * BENCH_TILE_SIZE * BENCH_TILE_SIZE * 2);
+    bench_run("tilemap", &state, num_frames);
+
+    // Cost of sprites, MAX_ROW_SPRITES of them sharing each row
+    for (i = MAX_ROW_SPRITES / 2; i <= MAX_SPRITES; i *= 2) {
+        sprintf(name, "%d sprites", i);
+        bench_init_sprites(&state, i);
+        bench_run(name, &state, num_frames);
+    }
+
+    // Blending, over a scrolling backdrop
+    bench_init_state(&state, true, NULL, 0);
+    bench_init_image_layer(&state.layer[0], IMG_FORMAT_RGB565, MAX_OPACITY);
+    bench_run("opaque image", &state, num_frames);
+    bench_init_image_layer(&state.layer[0], IMG_FORMAT_RGB565, MAX_OPACITY / 2);
+    bench_run("translucent image", &state, num_frames);
+    bench_init_image_layer(&state.layer[0], IMG_FORMAT_ARGB4444, MAX_OPACITY);
+    bench_run("argb4444 image", &state, num_frames);
+    bench_init_state(&state, true, font[FONT_ID_CONSOLE_5X8], 1);
+    state.layer[0].box.opacity = MAX_OPACITY / 2;
+    bench_run("translucent text", &state, num_frames);
+
+    // Proportional text, scrolling, and with its characters changing every frame so it's laid out again
+    bench_init_state(&state, true, &bench_prop_font, 1);
+    bench_run("proportional text", &state, num_frames);
+    state.layer[0].box.src_width = 20;
+    state.layer[0].anim.anim[0].x.delta = 0;
+    state.layer[0].anim.anim[0].src_data.delta = 1;
+    state.layer[0].anim.anim[0].src_data.iterations_until_restart = strlen(bench_text) - 20;
+    bench_run("retyped proportional", &state, num_frames);
+    bench_init_state(&state, true, font[FONT_ID_CONSOLE_5X8], 1);
+    state.layer[0].box.src_width = 20;
+    state.layer[0].anim.anim[0].x.delta = 0;
+    state.layer[0].anim.anim[0].src_data.delta = 1;
+    state.layer[0].anim.anim[0].src_data.iterations_until_restart = strlen(bench_text) - 20;
+    bench_run("retyped text", &state, num_frames);
+
+    // Proportional tickers past the room in the text cache, the last ones drawn from the font
+    bench_init_state(&state, true, font[FONT_ID_DEJAVU_F16], MAX_LAYERS);
+    bench_run("proportional no room", &state, num_frames);
+
+    // Anti-aliased text, over the backdrop and over a background color
+    bench_init_state(&state, true, &bench_aa_font, 1);
+    bench_run("anti-aliased", &state, num_frames);
+    state.layer[0].box.bg_color = 0x001f;
+    bench_run("anti-aliased on bg", &state, num_frames);
+
+    // Anti-aliased tickers past the room in the text cache, the last ones drawn from the font
+    bench_init_state(&state, true, font[FONT_ID_DEJAVU_AA16], 3);
+    bench_run("anti-aliased no room", &state, num_frames);
+
+    return 0;
+}
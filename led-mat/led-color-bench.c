@@ -0,0 +1,178 @@
+// Benchmark of the bitplane encoder on the host
+// Encodes the same rows with the shift and mask encoder the lookup tables replaced and with
+// parse_color, in ns per row, and checks both write the same bitplanes. The old encoder took the
+// top bits of each component as they are, so the tables are built with COLOR_GAMMA_RAW for it.
+// The rows start with every RGB565 value, top and bottom, and carry on with random pixels.
+// usage: led-color-bench [rows]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "led-render.h"
+
+// Words of source pixels per row, 4 columns of the top and bottom row per parse_color
+#define BENCH_ROW_WORDS (LED_PANEL_WIDTH / 4 * 4)
+
+static uint32_t bench_planes[2][LED_MAX_BPC][SCAN_DATA_WORDS];
+
+static uint64_t bench_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static inline void bench_swap8(uint8_t* a, uint8_t* b)
+{
+    uint8_t t = *a;
+    *a = *b;
+    *b = t;
+}
+
+// Components of 2 pixels of each source word, lined up with the msb of each byte
+static inline uint32_t bench_src565_red(uint32_t src_color0, uint32_t src_color1)
+{
+    return ((src_color0 & LED_SRC_565_R_MASK) >> 8) | (src_color1 & LED_SRC_565_R_MASK);
+}
+
+static inline uint32_t bench_src565_green(uint32_t src_color0, uint32_t src_color1)
+{
+    return ((src_color0 & LED_SRC_565_G_MASK) >> 3) | ((src_color1 & LED_SRC_565_G_MASK) << 5);
+}
+
+static inline uint32_t bench_src565_blue(uint32_t src_color0, uint32_t src_color1)
+{
+    return ((src_color0 & LED_SRC_565_B_MASK) << 3) | ((src_color1 & LED_SRC_565_B_MASK) << 11);
+}
+
+// Shifts the msb of each byte of comp_color down to pin, a plane at a time from the top one
+static inline void bench_planes_shift(uint32_t* dst_data, uint32_t comp_color, uint8_t pin, uint8_t bpc, bool first)
+{
+    uint8_t bit;
+    uint32_t* dst;
+    for (bit = 0; bit < bpc; bit++) {
+        dst = dst_data + (bpc - 1 - bit) * SCAN_DATA_WORDS;
+        if (first) {
+            *dst = (comp_color & 0x80808080) >> (7 - (pin - HUB75_COLOR_BASE));
+        } else {
+            *dst |= (comp_color & 0x80808080) >> (7 - (pin - HUB75_COLOR_BASE));
+        }
+        comp_color <<= 1;
+    }
+}
+
+// The encoder before the lookup tables, with its fixed bit depth made a parameter
+static void bench_parse_color_shift(uint32_t* dst_data, const uint32_t* src_color, uint8_t bpc)
+{
+    uint8_t* dst_data_addr8;
+    uint8_t bit;
+
+    bench_planes_shift(dst_data, bench_src565_red(src_color[0], src_color[1]), HUB75_R0, bpc, true);
+    bench_planes_shift(dst_data, bench_src565_green(src_color[0], src_color[1]), HUB75_G0, bpc, false);
+    bench_planes_shift(dst_data, bench_src565_blue(src_color[0], src_color[1]), HUB75_B0, bpc, false);
+    bench_planes_shift(dst_data, bench_src565_red(src_color[2], src_color[3]), HUB75_R1, bpc, false);
+    bench_planes_shift(dst_data, bench_src565_green(src_color[2], src_color[3]), HUB75_G1, bpc, false);
+    bench_planes_shift(dst_data, bench_src565_blue(src_color[2], src_color[3]), HUB75_B1, bpc, false);
+    // the pixels of the two source words come out interleaved
+    for (bit = 0; bit < bpc; bit++) {
+        dst_data_addr8 = (uint8_t*)(dst_data + bit * SCAN_DATA_WORDS);
+        bench_swap8(dst_data_addr8 + 1, dst_data_addr8 + 2);
+    }
+}
+
+// Every RGB565 value, top and bottom, then random pixels
+static void bench_fill(uint32_t* rows, uint32_t num_rows)
+{
+    uint16_t* pixel = (uint16_t*)rows;
+    uint32_t top = 0;
+    uint32_t i, p;
+
+    // each parse_color takes 4 top pixels in 2 words, then the 4 below them
+    for (i = 0; i < num_rows * BENCH_ROW_WORDS / 4; i++) {
+        for (p = 0; p < 4; p++) {
+            if (top < 0x10000) {
+                pixel[8 * i + p] = top;
+                pixel[8 * i + 4 + p] = 0xffff - top;
+                top++;
+            } else {
+                pixel[8 * i + p] = rand();
+                pixel[8 * i + 4 + p] = rand();
+            }
+        }
+    }
+}
+
+static void bench_encode(bool lut, const uint32_t* src, uint8_t bpc)
+{
+    uint32_t i;
+    if (lut) {
+        for (i = 0; i < SCAN_DATA_WORDS; i++) {
+            parse_color(bench_planes[1][0] + i, src + 4 * i);
+        }
+    } else {
+        for (i = 0; i < SCAN_DATA_WORDS; i++) {
+            bench_parse_color_shift(bench_planes[0][0] + i, src + 4 * i, bpc);
+        }
+    }
+}
+
+static double bench_run(bool lut, const uint32_t* rows, uint32_t num_rows, uint8_t bpc)
+{
+    uint64_t start = bench_ns();
+    uint32_t r;
+    for (r = 0; r < num_rows; r++) {
+        bench_encode(lut, rows + r * BENCH_ROW_WORDS, bpc);
+    }
+    return (double)(bench_ns() - start) / num_rows;
+}
+
+// Rows the two encoders write different bitplanes for, only the planes of the bit depth are sent
+static uint32_t bench_check(const uint32_t* rows, uint32_t num_rows, uint8_t bpc)
+{
+    uint32_t mismatch = 0;
+    uint32_t r, plane;
+    for (r = 0; r < num_rows; r++) {
+        bench_encode(false, rows + r * BENCH_ROW_WORDS, bpc);
+        bench_encode(true, rows + r * BENCH_ROW_WORDS, bpc);
+        for (plane = 0; plane < bpc; plane++) {
+            if (memcmp(bench_planes[0][plane], bench_planes[1][plane], sizeof(bench_planes[0][0])) != 0) {
+                mismatch++;
+                break;
+            }
+        }
+    }
+    return mismatch;
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t num_rows = (argc > 1) ? strtoul(argv[1], NULL, 0) : 20000;
+    uint32_t* rows;
+    uint32_t mismatch, failed = 0;
+    double before, after;
+    uint8_t bpc;
+
+    // enough rows for every RGB565 value
+    if (num_rows < 0x10000 / LED_PANEL_WIDTH) {
+        printf("usage: %s [rows, at least %d]\n", argv[0], 0x10000 / LED_PANEL_WIDTH);
+        return 1;
+    }
+    rows = malloc(num_rows * BENCH_ROW_WORDS * sizeof(uint32_t));
+    bench_fill(rows, num_rows);
+
+    printf("depth   before ns/row   after ns/row\n");
+    for (bpc = LED_MIN_BPC; bpc <= LED_MAX_BPC; bpc++) {
+        init_color_lut(bpc, COLOR_GAMMA_RAW, false);
+        before = bench_run(false, rows, num_rows, bpc);
+        after = bench_run(true, rows, num_rows, bpc);
+        mismatch = bench_check(rows, num_rows, bpc);
+        printf("%5u   %13.1f  %13.1f\n", bpc, before, after);
+        if (mismatch) {
+            printf("the lookup tables wrote different bitplanes in %lu rows\n", (unsigned long)mismatch);
+            failed++;
+        }
+    }
+    free(rows);
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,260 @@
+// Loopback test of the DMX receiver on the host
+// A thread sends the universes that cover the panel over UDP on localhost, as E1.31 or Art-Net
+// and with or without sync packets, while the receiver takes them in the way the firmware does,
+// swapping at a simulated refresh rate, and checks that every frame it shows came in whole and
+// that every universe landed where it's mapped
+// usage: led-dmx-test [seconds] [fps] [refresh Hz] [pixels per universe] [artnet] [sync] [packets lost in %]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <pthread.h>
+#include <poll.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include "led-dmx.h"
+
+#define TEST_PORT (DMX_SACN_PORT + 100)
+#define TEST_SYNC_UNIVERSE 999
+
+static STREAM_T test_stream;
+static DMX_T test_dmx;
+static volatile bool test_done = false;
+static double test_fps;
+static bool test_artnet;
+static bool test_sync;
+static uint32_t test_loss;
+static uint32_t test_sent = 0;
+
+static uint64_t test_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static void test_be16(uint8_t* p, uint16_t v)
+{
+    p[0] = v >> 8;
+    p[1] = v & 0xff;
+}
+
+static void test_be32(uint8_t* p, uint32_t v)
+{
+    test_be16(p, v >> 16);
+    test_be16(p + 2, v & 0xffff);
+}
+
+// E1.31 root layer, with the flags and length of each layer from offset 16 on
+static void test_sacn_root(uint8_t* dst, uint32_t len, uint32_t vector)
+{
+    static const uint8_t id[12] = { 'A', 'S', 'C', '-', 'E', '1', '.', '1', '7', 0, 0, 0 };
+    memset(dst, 0, len);
+    test_be16(dst, 0x10);
+    memcpy(dst + 4, id, sizeof(id));
+    test_be16(dst + 16, 0x7000 | (len - 16));
+    test_be32(dst + 18, vector);
+    test_be16(dst + 38, 0x7000 | (len - 38));
+}
+
+static uint32_t test_encode(uint8_t* dst, uint16_t universe, uint8_t seq, const uint8_t* levels, uint32_t channels)
+{
+    if (test_artnet) {
+        memcpy(dst, "Art-Net", 8);
+        dst[8] = 0x00;
+        dst[9] = 0x50;
+        test_be16(dst + 10, 14);
+        dst[12] = seq;
+        dst[13] = 0;
+        dst[14] = universe & 0xff;
+        dst[15] = universe >> 8;
+        test_be16(dst + 16, channels);
+        memcpy(dst + 18, levels, channels);
+        return 18 + channels;
+    }
+    test_sacn_root(dst, 126 + channels, 0x4);
+    test_be32(dst + 40, 0x2);
+    strcpy((char*)dst + 44, "led-dmx-test");
+    dst[108] = 100;
+    test_be16(dst + 109, test_sync ? TEST_SYNC_UNIVERSE : 0);
+    dst[111] = seq;
+    test_be16(dst + 113, universe);
+    test_be16(dst + 115, 0x7000 | (126 + channels - 115));
+    dst[117] = 0x02;
+    dst[118] = 0xa1;
+    test_be16(dst + 121, 1);
+    test_be16(dst + 123, channels + 1);
+    memcpy(dst + 126, levels, channels);
+    return 126 + channels;
+}
+
+static uint32_t test_encode_sync(uint8_t* dst, uint8_t seq)
+{
+    if (test_artnet) {
+        memset(dst, 0, 14);
+        memcpy(dst, "Art-Net", 8);
+        dst[9] = 0x52;
+        test_be16(dst + 10, 14);
+        return 14;
+    }
+    test_sacn_root(dst, 49, 0x8);
+    test_be32(dst + 40, 0x1);
+    dst[44] = seq;
+    test_be16(dst + 45, TEST_SYNC_UNIVERSE);
+    return 49;
+}
+
+// Red holds the frame id and green the universe, both exact in RGB565, so a frame mixing two
+// of them or a universe off its place shows up
+static void* test_sender(void* arg)
+{
+    int sock = socket(AF_INET, SOCK_DGRAM, 0);
+    struct sockaddr_in addr;
+    uint8_t levels[DMX_CHANNELS];
+    uint8_t packet[DMX_MAX_PACKET];
+    uint32_t frame = 0;
+    uint32_t u, i, len;
+    uint64_t next_ns = test_ns();
+    struct timespec ts;
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(TEST_PORT);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    while (!test_done) {
+        for (u = 0; u < test_dmx.num_universes; u++) {
+            for (i = 0; i < test_dmx.universe_pixels; i++) {
+                levels[3 * i] = (frame & 0x1f) << 3;
+                levels[3 * i + 1] = (u & 0x3f) << 2;
+                levels[3 * i + 2] = 0;
+            }
+            len = test_encode(packet, test_dmx.first_universe + u, frame, levels, 3 * test_dmx.universe_pixels);
+            if ((uint32_t)(rand() % 100) < test_loss) continue;
+            sendto(sock, packet, len, 0, (struct sockaddr*)&addr, sizeof(addr));
+        }
+        if (test_sync) {
+            len = test_encode_sync(packet, frame);
+            sendto(sock, packet, len, 0, (struct sockaddr*)&addr, sizeof(addr));
+        }
+        frame++;
+        test_sent++;
+
+        next_ns += (uint64_t)(1000000000.0 / test_fps);
+        ts.tv_sec = next_ns / 1000000000ull;
+        ts.tv_nsec = next_ns % 1000000000ull;
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL);
+    }
+    close(sock);
+    return NULL;
+}
+
+// A shown frame has to be one frame, with every universe where it belongs
+// Lost universes keep the levels of an earlier frame, so frames only mix when packets are lost
+static void test_check(const uint32_t* frame, uint32_t* mixed, uint32_t* misplaced)
+{
+    const uint16_t* pixel = (const uint16_t*)frame;
+    uint16_t id = pixel[0] >> 11;
+    bool mix = false;
+    uint32_t p, u;
+
+    for (p = 0; p < LED_PANEL_WIDTH * LED_PANEL_HEIGHT; p++) {
+        u = p / test_dmx.universe_pixels;
+        if ((pixel[p] & 0x7ff) != ((u & 0x3f) << 5)) {
+            (*misplaced)++;
+            return;
+        }
+        if ((pixel[p] >> 11) != id) mix = true;
+    }
+    if (mix) (*mixed)++;
+}
+
+int main(int argc, char** argv)
+{
+    double seconds = (argc > 1) ? strtod(argv[1], NULL) : 5.0;
+    double refresh = (argc > 3) ? strtod(argv[3], NULL) : 120.0;
+    uint32_t universe_pixels = (argc > 4) ? strtoul(argv[4], NULL, 0) : DMX_UNIVERSE_PIXELS;
+    int sock = socket(AF_INET, SOCK_DGRAM, 0);
+    int rcvbuf = 256 * 1024;
+    struct sockaddr_in addr;
+    struct pollfd pfd;
+    uint8_t packet[2048];
+    const uint32_t* frame;
+    uint64_t start_ns, end_ns, vsync_ns, now_ns, recv_ns = 0;
+    uint32_t mixed = 0;
+    uint32_t misplaced = 0;
+    uint32_t vsyncs = 0;
+    ssize_t len;
+    pthread_t sender;
+    int timeout;
+
+    test_fps = (argc > 2) ? strtod(argv[2], NULL) : 40.0;
+    test_artnet = (argc > 5) && atoi(argv[5]) != 0;
+    test_sync = (argc > 6) ? atoi(argv[6]) != 0 : true;
+    test_loss = (argc > 7) ? strtoul(argv[7], NULL, 0) : 0;
+    if (seconds <= 0 || test_fps <= 0 || refresh <= 0 || test_loss > 100) {
+        printf("usage: %s [seconds] [fps] [refresh Hz] [pixels per universe] [artnet] [sync] [packets lost in %%]\n", argv[0]);
+        return 1;
+    }
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(TEST_PORT);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    setsockopt(sock, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+    if (bind(sock, (struct sockaddr*)&addr, sizeof(addr)) != 0) {
+        perror("bind");
+        return 1;
+    }
+
+    stream_init(&test_stream);
+    dmx_config(&test_dmx, DMX_DEF_FIRST_UNIVERSE, universe_pixels, 0);
+    printf("%u universes of %u pixels, %s%s\n", test_dmx.num_universes, test_dmx.universe_pixels,
+        test_artnet ? "Art-Net" : "E1.31", test_sync ? " with sync" : "");
+    pthread_create(&sender, NULL, test_sender, NULL);
+    start_ns = test_ns();
+    end_ns = start_ns + (uint64_t)(seconds * 1e9);
+    vsync_ns = start_ns;
+    pfd.fd = sock;
+    pfd.events = POLLIN;
+
+    while ((now_ns = test_ns()) < end_ns) {
+        // the frame boundary, as the main loop of the firmware sees it
+        if (now_ns >= vsync_ns) {
+            frame = stream_swap(&test_stream);
+            if (frame) test_check(frame, &mixed, &misplaced);
+            vsyncs++;
+            vsync_ns += (uint64_t)(1e9 / refresh);
+            continue;
+        }
+        timeout = (vsync_ns - now_ns + 999999) / 1000000;
+        if (poll(&pfd, 1, timeout) <= 0) continue;
+        len = recv(sock, packet, sizeof(packet), 0);
+        if (len <= 0) continue;
+        now_ns = test_ns();
+        if (test_artnet) {
+            dmx_artnet(&test_dmx, &test_stream, packet, len);
+        } else {
+            dmx_sacn(&test_dmx, &test_stream, packet, len);
+        }
+        recv_ns += test_ns() - now_ns;
+    }
+    test_done = true;
+    pthread_join(sender, NULL);
+
+    seconds = (test_ns() - start_ns) / 1e9;
+    printf("sent      %8lu frames  %7.1f fps\n", (unsigned long)test_sent, test_sent / seconds);
+    printf("received  %8lu frames  %7.1f fps  %lu universes, %.2f us each\n", (unsigned long)test_dmx.stats.frames,
+        test_dmx.stats.frames / seconds, (unsigned long)test_dmx.stats.packets,
+        test_dmx.stats.packets ? recv_ns / 1e3 / test_dmx.stats.packets : 0.0);
+    printf("synced    %8lu frames\n", (unsigned long)test_dmx.stats.synced);
+    printf("partial   %8lu frames, cut short by a universe coming again\n", (unsigned long)test_dmx.stats.partial);
+    printf("shown     %8lu frames  %7.1f fps  of %lu refreshes\n", (unsigned long)test_stream.stats.shown,
+        test_stream.stats.shown / seconds, (unsigned long)vsyncs);
+    printf("replaced  %8lu frames, by a newer one before the refresh\n", (unsigned long)test_stream.stats.replaced);
+    printf("errors    %8lu packets\n", (unsigned long)test_dmx.stats.errors);
+    printf("mixed     %8lu frames\n", (unsigned long)mixed);
+    printf("misplaced %8lu frames\n", (unsigned long)misplaced);
+    return (misplaced || (mixed && test_loss == 0)) ? 1 : 0;
+}
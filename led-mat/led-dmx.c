@@ -0,0 +1,192 @@
+// DMX over E1.31 (sACN) and Art-Net
+// Universes are converted from RGB888 straight into the back buffer of the frame stream, through
+// spans worked out when the mapping is configured, and the frame is handed over once all of them
+// are in, or on the sync packet when the sender synchronizes them
+
+#include "led-dmx.h"
+
+static const uint8_t SACN_ID[12] = { 'A', 'S', 'C', '-', 'E', '1', '.', '1', '7', 0, 0, 0 };
+static const uint32_t SACN_VECTOR_ROOT_DATA = 0x4;
+static const uint32_t SACN_VECTOR_ROOT_EXTENDED = 0x8;
+static const uint32_t SACN_VECTOR_DATA = 0x2;
+static const uint32_t SACN_VECTOR_SYNC = 0x1;
+static const uint8_t SACN_OPTION_PREVIEW = 0x80;
+static const uint8_t SACN_OPTION_TERMINATED = 0x40;
+static const uint32_t SACN_DATA_HEADER = 126;
+static const uint32_t SACN_SYNC_SIZE = 49;
+
+static const uint8_t ARTNET_ID[8] = { 'A', 'r', 't', '-', 'N', 'e', 't', 0 };
+static const uint16_t ARTNET_OP_DMX = 0x5000;
+static const uint16_t ARTNET_OP_SYNC = 0x5200;
+static const uint32_t ARTNET_DMX_HEADER = 18;
+
+static uint16_t dmx_be16(const uint8_t* p)
+{
+    return (p[0] << 8) | p[1];
+}
+
+static uint32_t dmx_be32(const uint8_t* p)
+{
+    return ((uint32_t)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+// Works out which pixels of the panel each universe covers, a span for each row it touches
+void dmx_config(DMX_T* dmx, uint16_t first_universe, uint8_t universe_pixels, uint8_t flags)
+{
+    uint32_t total = LED_PANEL_WIDTH * LED_PANEL_HEIGHT;
+    uint32_t u, p, n, row, col;
+    DMX_UNIVERSE_T* universe;
+    DMX_SPAN_T* span;
+
+    if (universe_pixels == 0 || universe_pixels > DMX_UNIVERSE_PIXELS) universe_pixels = DMX_UNIVERSE_PIXELS;
+    if (universe_pixels < DMX_MIN_UNIVERSE_PIXELS) universe_pixels = DMX_MIN_UNIVERSE_PIXELS;
+    dmx->first_universe = first_universe;
+    dmx->universe_pixels = universe_pixels;
+    dmx->flags = flags;
+    dmx->num_universes = (total + universe_pixels - 1) / universe_pixels;
+    dmx->all_mask = (dmx->num_universes == 64) ? ~0ull : (1ull << dmx->num_universes) - 1;
+    dmx->done_mask = 0;
+
+    for (u = 0; u < dmx->num_universes; u++) {
+        universe = &dmx->universe[u];
+        universe->num_spans = 0;
+        for (p = 0; p < universe_pixels && u * universe_pixels + p < total; p += n) {
+            row = (u * universe_pixels + p) / LED_PANEL_WIDTH;
+            col = (u * universe_pixels + p) % LED_PANEL_WIDTH;
+            n = LED_PANEL_WIDTH - col;
+            if (n > universe_pixels - p) n = universe_pixels - p;
+            span = &universe->span[universe->num_spans++];
+            span->channel = 3 * p;
+            span->count = n;
+            if ((flags & DMX_SERPENTINE) && (row & 1)) {
+                span->pixel = row * LED_PANEL_WIDTH + LED_PANEL_WIDTH - 1 - col;
+                span->step = -1;
+            } else {
+                span->pixel = row * LED_PANEL_WIDTH + col;
+                span->step = 1;
+            }
+        }
+    }
+}
+
+static void dmx_complete(DMX_T* dmx, STREAM_T* stream)
+{
+    stream_complete(stream);
+    dmx->done_mask = 0;
+    dmx->stats.frames++;
+}
+
+static void dmx_universe(DMX_T* dmx, STREAM_T* stream, uint16_t universe, const uint8_t* data, uint32_t channels, bool sync)
+{
+    uint16_t u = universe - dmx->first_universe;
+    uint64_t bit;
+    uint16_t* pixels;
+    const DMX_SPAN_T* span;
+    const uint8_t* src;
+    uint16_t* dst;
+    uint32_t s, i, count;
+
+    if (universe < dmx->first_universe || u >= dmx->num_universes) return;
+    bit = 1ull << u;
+    dmx->stats.packets++;
+
+    // a universe coming again means the rest of the frame, or its sync, isn't coming
+    if (dmx->done_mask & bit) {
+        dmx->stats.partial++;
+        dmx->artnet_sync = false;
+        dmx_complete(dmx, stream);
+    }
+    pixels = (uint16_t*)stream->buffer[stream->back];
+    // universes the frame doesn't get keep showing what they showed last
+    if (!dmx->done_mask) memcpy(pixels, stream->buffer[stream->front], sizeof(stream->buffer[0]));
+
+    for (s = 0; s < dmx->universe[u].num_spans; s++) {
+        span = &dmx->universe[u].span[s];
+        if (span->channel + 3 > channels) break;
+        count = (channels - span->channel) / 3;
+        if (count > span->count) count = span->count;
+        src = data + span->channel;
+        dst = pixels + span->pixel;
+        for (i = 0; i < count; i++) {
+            *dst = ((src[0] & 0xf8) << 8) | ((src[1] & 0xfc) << 3) | (src[2] >> 3);
+            src += 3;
+            dst += span->step;
+        }
+    }
+
+    dmx->done_mask |= bit;
+    if (!sync && dmx->done_mask == dmx->all_mask) dmx_complete(dmx, stream);
+}
+
+static void dmx_sync(DMX_T* dmx, STREAM_T* stream)
+{
+    if (!dmx->done_mask) return;
+    dmx->stats.synced++;
+    dmx_complete(dmx, stream);
+}
+
+void dmx_sacn(DMX_T* dmx, STREAM_T* stream, const uint8_t* packet, uint32_t len)
+{
+    uint32_t root, count;
+    uint16_t sync_universe;
+
+    if (len < SACN_SYNC_SIZE || memcmp(packet + 4, SACN_ID, sizeof(SACN_ID)) != 0) {
+        dmx->stats.errors++;
+        return;
+    }
+    root = dmx_be32(packet + 18);
+    if (root == SACN_VECTOR_ROOT_EXTENDED && dmx_be32(packet + 40) == SACN_VECTOR_SYNC) {
+        if (dmx_be16(packet + 45) == dmx->sync_universe) dmx_sync(dmx, stream);
+        return;
+    }
+    if (root != SACN_VECTOR_ROOT_DATA || len < SACN_DATA_HEADER || dmx_be32(packet + 40) != SACN_VECTOR_DATA ||
+        packet[117] != 0x02 || packet[118] != 0xa1) {
+        dmx->stats.errors++;
+        return;
+    }
+    // previews are for the desk's visualizer, and a terminated stream carries no levels
+    if (packet[112] & (SACN_OPTION_PREVIEW | SACN_OPTION_TERMINATED)) return;
+    // only the null start code carries levels
+    if (packet[125] != 0) return;
+
+    count = dmx_be16(packet + 123);
+    if (count == 0 || SACN_DATA_HEADER + count - 1 > len) {
+        dmx->stats.errors++;
+        return;
+    }
+    sync_universe = dmx_be16(packet + 109);
+    if (sync_universe) dmx->sync_universe = sync_universe;
+    dmx_universe(dmx, stream, dmx_be16(packet + 113), packet + SACN_DATA_HEADER, count - 1, sync_universe != 0);
+}
+
+void dmx_artnet(DMX_T* dmx, STREAM_T* stream, const uint8_t* packet, uint32_t len)
+{
+    uint16_t op;
+    uint32_t count;
+
+    if (len < 10 || memcmp(packet, ARTNET_ID, sizeof(ARTNET_ID)) != 0) {
+        dmx->stats.errors++;
+        return;
+    }
+    op = packet[8] | (packet[9] << 8);
+    if (op == ARTNET_OP_SYNC) {
+        // once the sender syncs, frames wait for it until it stops
+        dmx->artnet_sync = true;
+        dmx_sync(dmx, stream);
+        return;
+    }
+    // polls and the rest of the opcodes are for other nodes
+    if (op != ARTNET_OP_DMX) return;
+
+    if (len < ARTNET_DMX_HEADER) {
+        dmx->stats.errors++;
+        return;
+    }
+    count = dmx_be16(packet + 16);
+    if (count > DMX_CHANNELS || ARTNET_DMX_HEADER + count > len) {
+        dmx->stats.errors++;
+        return;
+    }
+    // the universe is the 15 bit port address, subnet and universe then net
+    dmx_universe(dmx, stream, packet[14] | ((packet[15] & 0x7f) << 8), packet + ARTNET_DMX_HEADER, count, dmx->artnet_sync);
+}
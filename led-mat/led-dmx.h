@@ -0,0 +1,74 @@
+//
+// LED Matrix DMX receiver
+// Takes E1.31 (sACN) and Art-Net universes from a lighting desk, each one RGB888 pixels that
+// map onto a run of the panel, and hands the frames they make to the frame stream
+// Without any Pico SDK dependency, so test harnesses on the host share it
+//
+
+#ifndef __LED_DMX_H
+#define __LED_DMX_H
+
+#include "led-stream.h"
+
+#define DMX_SACN_PORT 5568
+#define DMX_ARTNET_PORT 6454
+
+// A universe holds 512 channels, so at most 170 RGB pixels
+#define DMX_CHANNELS 512
+#define DMX_UNIVERSE_PIXELS 170
+
+// Universes that can cover the panel, which limits how few pixels each may hold
+#define DMX_MAX_UNIVERSES 64
+#define DMX_MIN_UNIVERSE_PIXELS ((LED_PANEL_WIDTH * LED_PANEL_HEIGHT + DMX_MAX_UNIVERSES - 1) / DMX_MAX_UNIVERSES)
+
+// Runs of a universe within one row of the panel, as many as the rows it can touch
+#define DMX_MAX_SPANS ((DMX_UNIVERSE_PIXELS + LED_PANEL_WIDTH - 2) / LED_PANEL_WIDTH + 1)
+
+// Biggest packets that are parsed, an E1.31 data packet with all 512 channels
+#define DMX_MAX_PACKET (126 + DMX_CHANNELS)
+
+// Universe the panel starts at until configured otherwise
+static const uint16_t DMX_DEF_FIRST_UNIVERSE = 1;
+
+// Universe mapping flags
+static const uint8_t DMX_SERPENTINE = 0x1;  // every other row runs right to left
+
+typedef struct DMX_SPAN_T_ {
+    uint16_t pixel;  // of the panel the first channel goes to
+    uint16_t channel;  // first channel of the span
+    uint16_t count;  // pixels
+    int16_t step;  // to the next pixel of the panel, -1 for rows running right to left
+} DMX_SPAN_T;
+
+typedef struct DMX_UNIVERSE_T_ {
+    uint8_t num_spans;
+    DMX_SPAN_T span[DMX_MAX_SPANS];
+} DMX_UNIVERSE_T;
+
+typedef struct DMX_STATS_T_ {
+    uint32_t packets;  // universes received that are mapped
+    uint32_t frames;  // handed to the frame stream
+    uint32_t synced;  // of those, released by a sync packet
+    uint32_t partial;  // of those, cut short by a universe coming again before all came in or the sync
+    uint32_t errors;  // packets that were malformed
+} DMX_STATS_T;
+
+typedef struct DMX_T_ {
+    uint16_t first_universe;
+    uint8_t num_universes;
+    uint8_t universe_pixels;
+    uint8_t flags;
+    DMX_UNIVERSE_T universe[DMX_MAX_UNIVERSES];  // where each universe goes, worked out once by dmx_config
+    uint64_t all_mask;  // a bit for each universe mapped
+    uint64_t done_mask;  // universes of the frame being received
+    uint16_t sync_universe;  // E1.31 universe the sync packets come on, 0 for none
+    bool artnet_sync;  // the Art-Net sender has been sending ArtSync
+    DMX_STATS_T stats;
+} DMX_T;
+
+// DMX functions
+void dmx_config(DMX_T* dmx, uint16_t first_universe, uint8_t universe_pixels, uint8_t flags);
+void dmx_sacn(DMX_T* dmx, STREAM_T* stream, const uint8_t* packet, uint32_t len);
+void dmx_artnet(DMX_T* dmx, STREAM_T* stream, const uint8_t* packet, uint32_t len);
+
+#endif  // __LED_DMX_H
@@ -0,0 +1,121 @@
+// Host side encoder for run-length coded animation frames
+// Each row is coded once; rows that repeat, in any earlier frame, point back at the first copy
+
+#include <stdlib.h>
+#include <string.h>
+#include "led-render.h"
+#include "led-encode.h"
+
+static size_t rle_put16(uint8_t* dst, size_t dst_size, size_t pos, uint16_t value)
+{
+    if (pos == 0 || pos + 2 > dst_size) return 0;
+    dst[pos] = value & 0xff;
+    dst[pos + 1] = value >> 8;
+    return pos + 2;
+}
+
+static void rle_put32(uint8_t* dst, size_t pos, int32_t value)
+{
+    dst[pos] = value & 0xff;
+    dst[pos + 1] = (value >> 8) & 0xff;
+    dst[pos + 2] = (value >> 16) & 0xff;
+    dst[pos + 3] = (value >> 24) & 0xff;
+}
+
+// Runs of 3 or more take a run token, everything in between goes out as literals
+static size_t rle_encode_row(uint8_t* dst, size_t dst_size, size_t pos, const uint16_t* pixel, uint32_t width)
+{
+    uint32_t x = 0;
+    uint32_t run, lit, i;
+
+    while (x < width) {
+        for (run = 1; x + run < width && pixel[x + run] == pixel[x] && run < RLE_MAX_COUNT; run++);
+        if (run >= 3) {
+            pos = rle_put16(dst, dst_size, pos, RLE_RUN | run);
+            pos = rle_put16(dst, dst_size, pos, pixel[x]);
+            x += run;
+            continue;
+        }
+        for (lit = 0; x + lit < width && lit < RLE_MAX_COUNT; lit++) {
+            i = x + lit;
+            if (i + 2 < width && pixel[i] == pixel[i + 1] && pixel[i] == pixel[i + 2]) break;
+        }
+        pos = rle_put16(dst, dst_size, pos, lit);
+        for (i = 0; i < lit; i++) {
+            pos = rle_put16(dst, dst_size, pos, pixel[x + i]);
+        }
+        x += lit;
+    }
+    return pos;
+}
+
+static uint32_t rle_hash(const uint16_t* pixel, uint32_t width)
+{
+    uint32_t hash = 2166136261u;
+    uint32_t x;
+    for (x = 0; x < width; x++) {
+        hash = (hash ^ pixel[x]) * 16777619u;
+    }
+    return hash;
+}
+
+size_t rle_encode(uint8_t* dst, size_t dst_size, const uint16_t* frames, uint32_t width, uint32_t height, uint32_t num_frames)
+{
+    uint32_t num_rows = num_frames * height;
+    size_t* row_pos = malloc(num_rows * sizeof(size_t));
+    uint32_t* row_hash = malloc(num_rows * sizeof(uint32_t));
+    size_t pos = 4 * (size_t)num_frames;
+    size_t frame_pos, data_pos;
+    uint32_t f, r, n, i;
+    const uint16_t* pixel;
+
+    if (!row_pos || !row_hash || pos > dst_size) {
+        pos = 0;
+        goto done;
+    }
+
+    for (f = 0; f < num_frames; f++) {
+        frame_pos = pos;
+        pos += 4 * (size_t)height;
+        if (pos > dst_size) {
+            pos = 0;
+            goto done;
+        }
+        rle_put32(dst, 4 * f, frame_pos - 4 * f);
+
+        for (r = 0; r < height; r++) {
+            n = f * height + r;
+            pixel = frames + (size_t)n * width;
+            row_hash[n] = rle_hash(pixel, width);
+
+            // the same row of the previous frame is the likely match, so it's checked first
+            data_pos = 0;
+            if (f > 0 && row_hash[n - height] == row_hash[n] && memcmp(pixel - height * width, pixel, 2 * width) == 0) {
+                data_pos = row_pos[n - height];
+            }
+            for (i = 0; i < n && data_pos == 0; i++) {
+                if (row_hash[i] == row_hash[n] && memcmp(frames + (size_t)i * width, pixel, 2 * width) == 0) {
+                    data_pos = row_pos[i];
+                }
+            }
+            if (data_pos == 0) {
+                data_pos = pos;
+                pos = rle_encode_row(dst, dst_size, pos, pixel, width);
+                if (pos == 0) goto done;
+            }
+            row_pos[n] = data_pos;
+            rle_put32(dst, frame_pos + 4 * r, data_pos - frame_pos);
+        }
+
+        // row tables are read as words
+        while (pos & 0x3) {
+            pos = rle_put16(dst, dst_size, pos, 0);
+            if (pos == 0) goto done;
+        }
+    }
+
+done:
+    free(row_pos);
+    free(row_hash);
+    return pos;
+}
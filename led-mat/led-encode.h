@@ -0,0 +1,14 @@
+// Host side encoder for run-length coded animation frames
+// Writes the IMG_FORMAT_RLE layout described in led-render.h
+
+#ifndef __LED_ENCODE_H
+#define __LED_ENCODE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Encodes num_frames frames of width x height RGB565 pixels
+// Returns the number of bytes written to dst, or 0 if they don't fit in dst_size
+size_t rle_encode(uint8_t* dst, size_t dst_size, const uint16_t* frames, uint32_t width, uint32_t height, uint32_t num_frames);
+
+#endif  // __LED_ENCODE_H
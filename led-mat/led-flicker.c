@@ -0,0 +1,102 @@
+// Flicker simulation for the host
+// Builds the scanout schedule of each bit depth and modulation scheme, follows the light
+// a pixel emits over one frame for every level, and reports the lowest frequency with a
+// harmonic above the threshold, for the level where it is lowest
+// Dim levels only light the short planes once per frame in either scheme, so the worst case
+// only covers the levels lighting one of the top two planes, which are the ones split mode breaks up
+// usage: led-flicker [brightness] [threshold %]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "led-render.h"
+
+// Highest harmonic of the refresh rate looked at
+#define FLICKER_MAX_HARMONIC 64
+
+static SCAN_FRAME_T flicker_frame;
+
+// Lowest harmonic of the frame rate whose amplitude is above threshold times the average
+static uint32_t flicker_harmonic(uint32_t level, float threshold, float* ratio)
+{
+    const uint32_t* base = flicker_frame.data[0][0];
+    uint32_t slot, plane, on, off, k;
+    float start, t = 0.0f;
+    float period = 0.0f;
+    float on_time = 0.0f;
+    float re[FLICKER_MAX_HARMONIC + 1] = { 0 };
+    float im[FLICKER_MAX_HARMONIC + 1] = { 0 };
+
+    // One pass for the frame period, then integrate e^-iwt over the time the pixel is lit
+    for (slot = 0; flicker_frame.sched[slot]; slot++) {
+        period += PIO_CTRL_INSTRUCTIONS + (flicker_frame.ctrl[slot][1] & 0xffff) + (flicker_frame.ctrl[slot][1] >> 16);
+    }
+    for (slot = 0; flicker_frame.sched[slot]; slot++) {
+        on = flicker_frame.ctrl[slot][1] & 0xffff;
+        off = flicker_frame.ctrl[slot][1] >> 16;
+        // Only the slots of the first row light the pixel, after the latch
+        plane = (flicker_frame.sched[slot] - base) / (LED_PANEL_WIDTH / 4);
+        start = t + PIO_CTRL_INSTRUCTIONS - 1;
+        if (plane < LED_MAX_BPC && (level & (1 << plane)) && on) {
+            on_time += on;
+            for (k = 1; k <= FLICKER_MAX_HARMONIC; k++) {
+                float w = 2.0f * (float)M_PI * k / period;
+                re[k] += (sinf(w * (start + on)) - sinf(w * start)) / w;
+                im[k] += (cosf(w * (start + on)) - cosf(w * start)) / w;
+            }
+        }
+        t += PIO_CTRL_INSTRUCTIONS + on + off;
+    }
+
+    for (k = 1; k <= FLICKER_MAX_HARMONIC; k++) {
+        // |c_k| / c_0, both over the same period
+        *ratio = sqrtf(re[k] * re[k] + im[k] * im[k]) / on_time;
+        if (*ratio > threshold) return k;
+    }
+    *ratio = 0.0f;
+    return FLICKER_MAX_HARMONIC + 1;
+}
+
+static void flicker_run(uint8_t bpc, uint8_t mode, uint8_t brightness, float threshold)
+{
+    uint32_t level, k, slots;
+    uint32_t worst_k = ~0u;
+    uint32_t worst_level = 0;
+    float ratio, worst_ratio = 0.0f;
+
+    flicker_frame.bpc = bpc;
+    scan_build_sched(&flicker_frame, brightness, mode);
+    for (slots = 0; flicker_frame.sched[slots]; slots++);
+
+    for (level = 1u << (bpc - 2); level < (1u << bpc); level++) {
+        k = flicker_harmonic(level, threshold, &ratio);
+        if (k < worst_k || (k == worst_k && ratio > worst_ratio)) {
+            worst_k = k;
+            worst_level = level;
+            worst_ratio = ratio;
+        }
+    }
+
+    printf("depth %u %-5s slots %4lu  ", bpc, (mode == SCAN_MODE_SPLIT) ? "split" : "bcm", (unsigned long)slots);
+    if (worst_k > FLICKER_MAX_HARMONIC) {
+        printf("lowest flicker above %lu Hz\n", (unsigned long)(FLICKER_MAX_HARMONIC * LED_REFRESH_HZ));
+    } else {
+        printf("lowest flicker %5lu Hz at %3.0f%% (level %lu)\n",
+            (unsigned long)(worst_k * LED_REFRESH_HZ), 100.0f * worst_ratio, (unsigned long)worst_level);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t brightness = (argc > 1) ? strtoul(argv[1], NULL, 0) : MAX_BRIGHTNESS / 2;
+    float threshold = ((argc > 2) ? strtof(argv[2], NULL) : 10.0f) / 100.0f;
+    uint8_t bpc;
+
+    if (brightness > MAX_BRIGHTNESS) brightness = MAX_BRIGHTNESS;
+
+    for (bpc = LED_MIN_BPC; bpc <= LED_MAX_BPC; bpc++) {
+        flicker_run(bpc, SCAN_MODE_BCM, brightness, threshold);
+        flicker_run(bpc, SCAN_MODE_SPLIT, brightness, threshold);
+    }
+    return 0;
+}
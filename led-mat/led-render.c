@@ -0,0 +1,1454 @@
+// Driver for led matrix for PICO W
+// Compositor, from the animation state to the encoded frames
+// Doesn't touch the hardware, so it also builds for the host
+
+#include <math.h>
+#include "led-render.h"
+
+SCAN_FRAME_T scan_frame[SCAN_NUM_FRAMES];
+
+// Bitplane bits of each color component, indexed by the RGB565 component value
+// Each byte holds one bitplane, lsb plane first, with the bit already on its pin
+// [group] holds planes 0-3 and 4-7, [half] is 0 for the top half of the panel, 1 for the bottom half
+typedef struct COLOR_LUT_T_ {
+    uint32_t red[2][2][32];
+    uint32_t green[2][2][64];
+    uint32_t blue[2][2][32];
+} COLOR_LUT_T;
+
+// One table per dither phase, each rounding the corrected level at a different threshold
+static COLOR_LUT_T color_lut[COLOR_DITHER_PHASES];
+static const COLOR_LUT_T* color_lut_cur = &color_lut[0];
+static uint8_t color_lut_bpc = 0;
+static uint16_t color_lut_gamma = 0;
+static bool color_lut_dither = false;
+
+// Order the phases round up in, so consecutive frames alternate
+static const uint8_t COLOR_DITHER_THRESHOLD[COLOR_DITHER_PHASES] = { 0, 2, 1, 3 };
+
+// Light output of a component in 0..1
+// gamma is in hundredths, 0 uses the CIE1931 lightness curve
+static float color_correct(float value, uint16_t gamma)
+{
+    float l;
+    if (gamma) return powf(value, gamma / 100.0f);
+    l = value * 100.0f;
+    if (l <= 8.0f) return l / 902.3f;
+    l = (l + 16.0f) / 116.0f;
+    return l * l * l;
+}
+
+static uint64_t color_lut_entry(uint32_t level, uint8_t pin, uint8_t bpc)
+{
+    uint64_t entry = 0;
+    uint8_t bit;
+    for (bit = 0; bit < bpc; bit++) {
+        if (level & (1 << bit)) entry |= 1ull << (8 * bit + pin - HUB75_COLOR_BASE);
+    }
+    return entry;
+}
+
+void init_color_lut(uint8_t bpc, uint16_t gamma, bool dither)
+{
+    uint32_t v, p, half, level;
+    uint32_t fixed_red[32];
+    uint32_t fixed_green[64];
+    uint64_t entry;
+    const uint8_t red_pin[2] = { HUB75_R0, HUB75_R1 };
+    const uint8_t green_pin[2] = { HUB75_G0, HUB75_G1 };
+    const uint8_t blue_pin[2] = { HUB75_B0, HUB75_B1 };
+    const uint32_t max_level = (1 << bpc) - 1;
+
+    // Corrected levels, with a fraction of COLOR_DITHER_PHASES steps
+    // Raw levels are the top bits of the component, as the shift and mask encoder took them
+    for (v = 0; v < 32; v++) {
+        if (gamma == COLOR_GAMMA_RAW) {
+            fixed_red[v] = ((v << 3) >> (8 - bpc)) * COLOR_DITHER_PHASES;
+        } else {
+            fixed_red[v] = color_correct(v / 31.0f, gamma) * max_level * COLOR_DITHER_PHASES + 0.5f;
+        }
+    }
+    for (v = 0; v < 64; v++) {
+        if (gamma == COLOR_GAMMA_RAW) {
+            fixed_green[v] = ((v << 2) >> (8 - bpc)) * COLOR_DITHER_PHASES;
+        } else {
+            fixed_green[v] = color_correct(v / 63.0f, gamma) * max_level * COLOR_DITHER_PHASES + 0.5f;
+        }
+    }
+
+    // Without dithering every phase rounds to the nearest level
+    for (p = 0; p < COLOR_DITHER_PHASES; p++) {
+        uint32_t threshold = dither ? COLOR_DITHER_THRESHOLD[p] : COLOR_DITHER_PHASES / 2;
+        COLOR_LUT_T* lut = &color_lut[p];
+        for (half = 0; half < 2; half++) {
+            for (v = 0; v < 32; v++) {
+                level = (fixed_red[v] + threshold) / COLOR_DITHER_PHASES;
+                if (level > max_level) level = max_level;
+                entry = color_lut_entry(level, red_pin[half], bpc);
+                lut->red[0][half][v] = entry;
+                lut->red[1][half][v] = entry >> 32;
+                entry = color_lut_entry(level, blue_pin[half], bpc);
+                lut->blue[0][half][v] = entry;
+                lut->blue[1][half][v] = entry >> 32;
+            }
+            for (v = 0; v < 64; v++) {
+                level = (fixed_green[v] + threshold) / COLOR_DITHER_PHASES;
+                if (level > max_level) level = max_level;
+                entry = color_lut_entry(level, green_pin[half], bpc);
+                lut->green[0][half][v] = entry;
+                lut->green[1][half][v] = entry >> 32;
+            }
+        }
+    }
+    color_lut_bpc = bpc;
+    color_lut_gamma = gamma;
+    color_lut_dither = dither;
+}
+
+// Four bitplanes of one column, from the top and bottom pixel
+static inline uint32_t encode_pixel_pair(uint32_t group, uint32_t pixel0, uint32_t pixel1)
+{
+    const COLOR_LUT_T* lut = color_lut_cur;
+    return lut->red[group][0][(pixel0 >> 11) & 0x1f] | lut->green[group][0][(pixel0 >> 5) & 0x3f] | lut->blue[group][0][pixel0 & 0x1f] |
+        lut->red[group][1][(pixel1 >> 11) & 0x1f] | lut->green[group][1][(pixel1 >> 5) & 0x3f] | lut->blue[group][1][pixel1 & 0x1f];
+}
+
+static inline void encode_planes(uint32_t* dst_data, const uint32_t* src_color, uint32_t group)
+{
+    uint32_t c0, c1, c2, c3;
+    uint32_t t0, t1, t2, t3;
+
+    // Each column has a byte per bitplane
+    c0 = encode_pixel_pair(group, src_color[0], src_color[2]);
+    c1 = encode_pixel_pair(group, src_color[0] >> 16, src_color[2] >> 16);
+    c2 = encode_pixel_pair(group, src_color[1], src_color[3]);
+    c3 = encode_pixel_pair(group, src_color[1] >> 16, src_color[3] >> 16);
+
+    // Transpose so each bitplane has a byte per column, first column in the lsb
+    t0 = (c0 & 0x00ff00ff) | ((c1 & 0x00ff00ff) << 8);
+    t1 = ((c0 >> 8) & 0x00ff00ff) | (c1 & 0xff00ff00);
+    t2 = (c2 & 0x00ff00ff) | ((c3 & 0x00ff00ff) << 8);
+    t3 = ((c2 >> 8) & 0x00ff00ff) | (c3 & 0xff00ff00);
+
+    dst_data[0 * (LED_PANEL_WIDTH / 4)] = (t0 & 0xffff) | (t2 << 16);
+    dst_data[1 * (LED_PANEL_WIDTH / 4)] = (t1 & 0xffff) | (t3 << 16);
+    dst_data[2 * (LED_PANEL_WIDTH / 4)] = (t0 >> 16) | (t2 & 0xffff0000);
+    dst_data[3 * (LED_PANEL_WIDTH / 4)] = (t1 >> 16) | (t3 & 0xffff0000);
+}
+
+void parse_color(uint32_t* dst_data, const uint32_t* src_color)
+{
+    // There are always at least 4 bitplanes, the rest only when the depth needs them
+    encode_planes(dst_data, src_color, 0);
+    if (color_lut_bpc > 4) encode_planes(dst_data + 4 * (LED_PANEL_WIDTH / 4), src_color, 1);
+}
+
+void read_color(uint32_t* src_color, const uint32_t* src_color_row, uint32_t col, uint32_t width)
+{
+    const uint32_t* pixel;
+
+    // Grab 2 DWORDS, which correspond to 2 pixels
+    pixel = src_color_row + (col >> 1);
+    src_color[0] = *pixel;
+    pixel = (col + 2 >= width) ? src_color_row : pixel + 1;
+    src_color[1] = *pixel;
+    if (col & 0x1) {
+        src_color[0] >>= 16;
+        src_color[0] |= (src_color[1] << 16);
+        src_color[1] >>= 16;
+        pixel = (col + 3 == width) ? src_color_row : pixel + 1;
+        src_color[1] |= (*pixel << 16);
+    }
+}
+
+// Reads a whole panel row of a palette format, 8 bits per pixel or less, into one half of a line
+// dst gets 2 words of every 4, as read_color fills them
+void read_line_indexed(uint32_t* dst, const uint32_t* src_color_row, uint32_t col, uint32_t width, uint8_t bits, const uint16_t* palette)
+{
+    uint32_t i;
+    uint32_t mask = (1u << bits) - 1;
+    uint32_t bit = col * bits;
+    const uint32_t* src = src_color_row + (bit >> 5);
+    uint32_t index = *src >> (bit & 0x1f);
+    uint32_t shift = bit & 0x1f;
+    uint32_t pixel;
+
+    for (i = 0; i < LED_PANEL_WIDTH; i++) {
+        pixel = palette[index & mask];
+        if (i & 0x1) {
+            dst[(i >> 2) * 4 + ((i >> 1) & 0x1)] |= pixel << 16;
+        } else {
+            dst[(i >> 2) * 4 + ((i >> 1) & 0x1)] = pixel;
+        }
+        index >>= bits;
+        shift += bits;
+        if (++col == width) {
+            col = 0;
+            src = src_color_row;
+            index = *src;
+            shift = 0;
+        } else if (shift == 32) {
+            index = *(++src);
+            shift = 0;
+        }
+    }
+}
+
+// Data of a row of a run-length coded frame, src points at the frame's entry in the frame table
+const uint16_t* rle_row(const uint32_t* src, int32_t row)
+{
+    const int32_t* rows = (const int32_t*)((const uint8_t*)src + *(const int32_t*)src);
+    return (const uint16_t*)((const uint8_t*)rows + rows[row]);
+}
+
+static inline void line_put(uint32_t* dst, uint32_t col, uint32_t pixel)
+{
+    uint32_t* word = dst + (col >> 2) * 4 + ((col >> 1) & 0x1);
+    uint32_t shift = (col & 0x1) << 4;
+    *word = (*word & ~(0xffffu << shift)) | (pixel << shift);
+}
+
+// Decodes a run-length coded row into one half of a line, as read_line_indexed
+// Only the row itself is decoded, so no frame buffer is needed
+void read_line_rle(uint32_t* dst, const uint16_t* src, uint32_t col, uint32_t width)
+{
+    uint32_t x = 0;  // source column
+    uint32_t d = width - col;  // panel column of x, as long as it's past the wrap
+    uint32_t count, pixel, dx;
+    bool run;
+
+    while (x < width) {
+        count = *src++;
+        run = (count & RLE_RUN) != 0;
+        count &= RLE_MAX_COUNT;
+        if (x + count > width) count = width - x;
+        pixel = *src;
+        while (count--) {
+            if (!run) pixel = *src++;
+            if (x == col) d = 0;
+            for (dx = d; dx < LED_PANEL_WIDTH; dx += width) {
+                line_put(dst, dx, pixel);
+            }
+            x++;
+            d++;
+        }
+        if (run) src++;
+    }
+}
+
+// Reads a panel row of a tilemap into one half of a line, as read_line_indexed
+// map_row holds the tile indices of the row, and tile_row is the row within those tiles
+void read_line_tiles(uint32_t* dst, const uint16_t* map_row, uint32_t tile_row, uint32_t col, uint32_t width, uint8_t tile_shift, const uint16_t* tiles)
+{
+    uint32_t tile_size = 1u << tile_shift;
+    uint32_t i = 0;
+    uint32_t x, n;
+    const uint16_t* src;
+
+    // a tile's worth of pixels at a time
+    while (i < LED_PANEL_WIDTH) {
+        x = col & (tile_size - 1);
+        src = tiles + ((((uint32_t)map_row[col >> tile_shift] << tile_shift) + tile_row) << tile_shift) + x;
+        n = tile_size - x;
+        if (n > width - col) n = width - col;
+        if (n > LED_PANEL_WIDTH - i) n = LED_PANEL_WIDTH - i;
+        col += n;
+        if (col >= width) col = 0;
+        if (i & 0x1) {
+            line_put(dst, i++, *src++);
+            n--;
+        }
+        // whole words while there are pairs left
+        for (; n >= 2; n -= 2, i += 2, src += 2) {
+            dst[(i >> 2) * 4 + ((i >> 1) & 0x1)] = src[0] | ((uint32_t)src[1] << 16);
+        }
+        if (n) line_put(dst, i++, *src++);
+    }
+}
+
+uint8_t img_format_bits(uint8_t format)
+{
+    if (format == IMG_FORMAT_PAL8) return 8;
+    if (format == IMG_FORMAT_PAL4) return 4;
+    if (format == IMG_FORMAT_PAL2) return 2;
+    return 16;
+}
+
+void ibox_set_sample(IMG_BOX_T* ibox)
+{
+    int32_t src_index0 = ibox->src_row_index[0] + ibox->src_col_index;
+    int32_t src_index1 = ibox->src_row_index[1] + ibox->src_col_index;
+
+    if (ibox->font) {
+        src_index0 = (ibox->src_data[src_index0] * ibox->font->stride) + ibox->font_row[0];
+        src_index1 = (ibox->src_data[src_index1] * ibox->font->stride) + ibox->font_row[1];
+        ibox->src_sample[0] = ibox->font->glyphs + src_index0;
+        ibox->src_sample[1] = ibox->font->glyphs + src_index1;
+    } else {
+        ibox->src_sample[0] = ibox->src_data + 2 * src_index0;
+        ibox->src_sample[1] = ibox->src_data + 2 * src_index1;
+    }
+}
+
+void ibox_reset_row(IMG_BOX_T* ibox, uint16_t row)
+{
+    int16_t r0 = row - ibox->y - ibox->offset_y;
+    int16_t r1 = r0 + LED_SUBPANEL_HEIGHT;
+    int32_t src_row0 = r0;
+    int32_t src_row1 = r1;
+    if (ibox->font) {
+        src_row0 /= ibox->font->height;
+        src_row1 /= ibox->font->height;
+        r0 = r0 % ibox->font->height;
+        r1 = r1 % ibox->font->height;
+        if (r0 < 0) {
+            src_row0--;
+            r0 += ibox->font->height;
+        }
+        if (r1 < 0) {
+            src_row1--;
+            r1 += ibox->font->height;
+        }
+        ibox->font_row[0] = r0;
+        ibox->font_row[1] = r1;
+    }
+    src_row0 = src_row0 % ibox->src_height;
+    src_row1 = src_row1 % ibox->src_height;
+    if (src_row0 < 0) src_row0 += ibox->src_height;
+    if (src_row1 < 0) src_row1 += ibox->src_height;
+    ibox->src_row_index[0] = src_row0 * ibox->src_width;
+    ibox->src_row_index[1] = src_row1 * ibox->src_width;
+    ibox_set_sample(ibox);
+}
+
+void ibox_reset_col(IMG_BOX_T* ibox, int16_t col)
+{
+    int16_t c = col - ibox->x - ibox->offset_x;
+    int32_t src_col = c;
+    if (ibox->font) {
+        src_col /= ibox->font->width;
+        c = c % ibox->font->width;
+        if (c < 0) {
+            src_col--;
+            c += ibox->font->width;
+        }
+        ibox->font_col = c;
+    }
+    src_col = src_col % ibox->src_width;
+    if (src_col < 0) src_col += ibox->src_width;
+    ibox->src_col_index = src_col;
+    ibox_set_sample(ibox);
+}
+
+void ibox_inc_row(IMG_BOX_T* ibox)
+{
+    bool inc_src_row0 = true;
+    bool inc_src_row1 = true;
+    int32_t img_size = ibox->src_width * ibox->src_height;
+    if (ibox->font) {
+        ibox->font_row[0]++;
+        ibox->font_row[1]++;
+        if (ibox->font_row[0] >= ibox->font->height)
+            ibox->font_row[0] -= ibox->font->height;
+        else
+            inc_src_row0 = false;
+        if (ibox->font_row[1] >= ibox->font->height)
+            ibox->font_row[1] -= ibox->font->height;
+        else
+            inc_src_row1 = false;
+    }
+    if (inc_src_row0) {
+        ibox->src_row_index[0] += ibox->src_width;
+        if (ibox->src_row_index[0] >= img_size) ibox->src_row_index[0] -= img_size;
+    }
+    if (inc_src_row1) {
+        ibox->src_row_index[1] += ibox->src_width;
+        if (ibox->src_row_index[1] >= img_size) ibox->src_row_index[1] -= img_size;
+    }
+    //ibox_reset_col(ibox);
+}
+
+void ibox_inc_col(IMG_BOX_T* ibox)
+{
+    bool inc_src_col = true;
+    if (ibox->font) {
+        ibox->font_col++;
+        if (ibox->font_col >= ibox->font->width)
+            ibox->font_col -= ibox->font->width;
+        else
+            inc_src_col = false;
+    }
+    if (inc_src_col) {
+        ibox->src_col_index++;
+        if (ibox->src_col_index >= ibox->src_width) ibox->src_col_index -= ibox->src_width;
+        ibox_set_sample(ibox);
+    }
+}
+
+// Expands a 4 bit alpha to 0 - 256
+static inline uint32_t alpha_expand4(uint16_t pixel)
+{
+    return (pixel >> 12) * 17 + (pixel >> 15);
+}
+
+static inline uint16_t argb4444_to_rgb565(uint16_t pixel)
+{
+    uint16_t r = (pixel >> 8) & 0xf;
+    uint16_t g = (pixel >> 4) & 0xf;
+    uint16_t b = pixel & 0xf;
+    return (((r << 1) | (r >> 3)) << 11) | (((g << 2) | (g >> 2)) << 5) | ((b << 1) | (b >> 3));
+}
+
+// Blends src over dst with alpha from 0 to 32
+// Green goes into the top half of the word, so all 3 components get multiplied at once
+static inline uint16_t blend_rgb565(uint16_t dst, uint16_t src, uint32_t alpha)
+{
+    uint32_t d = (dst | ((uint32_t)dst << 16)) & 0x07e0f81f;
+    uint32_t s = (src | ((uint32_t)src << 16)) & 0x07e0f81f;
+    d = (d + (((s - d) * alpha) >> 5)) & 0x07e0f81f;
+    return d | (d >> 16);
+}
+
+// Writes a pixel with alpha from 0 to 256, scaled by the opacity of the box
+static inline void ibox_put_blend(uint32_t* dst, uint32_t col, uint16_t pixel, uint32_t alpha, uint32_t opacity)
+{
+    uint32_t* word = dst + (col >> 2) * 4 + ((col >> 1) & 0x1);
+    uint32_t shift = (col & 0x1) << 4;
+    alpha = (alpha * opacity) >> 11;
+    if (alpha) {
+        pixel = blend_rgb565((*word >> shift) & 0xffff, pixel, alpha);
+        *word = (*word & ~(0xffffu << shift)) | ((uint32_t)pixel << shift);
+    }
+}
+
+// Rasterizes the columns col0 to col1 of a box into the top and bottom rows of a line
+// The span has to be inside the box; it's walked a glyph or an image row at a time, so
+// the source is only looked up again at the start of the next glyph or when the image wraps
+static inline void ibox_span_run(IMG_BOX_T* ibox, uint32_t* line, uint16_t row, int16_t col0, int16_t col1, bool blend)
+{
+    uint32_t opacity = ibox->opacity + (ibox->opacity >> 7);  // 0 - 256
+    bool in_box[2];
+    int16_t c = col0;
+    int16_t n, k, j, r;
+    uint8_t glyph;
+    const uint16_t* src;
+    uint16_t pixel;
+
+    for (j = 0; j < 2; j++) {
+        r = row + j * LED_SUBPANEL_HEIGHT - ibox->y;
+        in_box[j] = r >= 0 && r < ibox->height;
+    }
+
+    ibox_reset_col(ibox, col0);
+    while (c < col1) {
+        n = ibox->font ? ibox->font->width - ibox->font_col : ibox->src_width - ibox->src_col_index;
+        if (n > col1 - c) n = col1 - c;
+
+        for (j = 0; j < 2; j++) {
+            if (!in_box[j]) continue;
+            if (ibox->font) {
+                glyph = *(ibox->src_sample[j]) << ibox->font_col;
+                for (k = 0; k < n; k++, glyph <<= 1) {
+                    if (glyph & 0x80) {
+                        pixel = ibox->fg_color;
+                    } else if (ibox->bg_color != NO_BACKGROUND) {
+                        pixel = ibox->bg_color;
+                    } else {
+                        continue;
+                    }
+                    if (blend) {
+                        ibox_put_blend(line + 2 * j, c + k, pixel, 256, opacity);
+                    } else {
+                        line_put(line + 2 * j, c + k, pixel);
+                    }
+                }
+            } else {
+                src = (const uint16_t*)ibox->src_sample[j];
+                for (k = 0; k < n; k++) {
+                    if (!blend) {
+                        line_put(line + 2 * j, c + k, src[k]);
+                    } else if (ibox->format == IMG_FORMAT_ARGB4444) {
+                        ibox_put_blend(line + 2 * j, c + k, argb4444_to_rgb565(src[k]), alpha_expand4(src[k]), opacity);
+                    } else {
+                        ibox_put_blend(line + 2 * j, c + k, src[k], 256, opacity);
+                    }
+                }
+            }
+        }
+
+        // on to the next glyph, or back to the start of the image row
+        c += n;
+        if (ibox->font) {
+            ibox->font_col = 0;
+            ibox->src_col_index++;
+            if (ibox->src_col_index >= ibox->src_width) ibox->src_col_index = 0;
+        } else {
+            ibox->src_col_index = 0;
+        }
+        ibox_set_sample(ibox);
+    }
+}
+
+void ibox_span(IMG_BOX_T* ibox, uint32_t* line, uint16_t row, int16_t col0, int16_t col1)
+{
+    ibox_span_run(ibox, line, row, col0, col1, false);
+}
+
+// Same as ibox_span, but blends the box over what is below it
+// Used for translucent layers and images with alpha, so opaque layers keep the plain path
+void ibox_span_blend(IMG_BOX_T* ibox, uint32_t* line, uint16_t row, int16_t col0, int16_t col1)
+{
+    ibox_span_run(ibox, line, row, col0, col1, true);
+}
+
+uint32_t row_set_mask(uint8_t row)
+{
+    uint32_t mask = 0;
+    uint32_t row32 = row;
+    mask |= (row32 & 0x01) << (HUB75_A0 - HUB75_ADDR_BASE - 0);
+    mask |= (row32 & 0x02) << (HUB75_A1 - HUB75_ADDR_BASE - 1);
+    mask |= (row32 & 0x04) << (HUB75_A2 - HUB75_ADDR_BASE - 2);
+    mask |= (row32 & 0x08) << (HUB75_A3 - HUB75_ADDR_BASE - 3);
+    mask |= (row32 & 0x10) << (HUB75_A4 - HUB75_ADDR_BASE - 4);
+    return mask;
+}
+
+// Slots of a row in split mode, as the plane and the delay shift of each one
+// The top SCAN_SPLIT_BITS planes are broken into slots no longer than the plane below them,
+// and the slots are ordered by their midpoint so each plane is spread evenly over the frame
+static uint32_t scan_split_slots(uint8_t* planes, uint8_t* shifts, uint8_t bpc)
+{
+    uint32_t keys[SCAN_ROW_SLOTS];
+    uint32_t count = 0;
+    uint32_t plane, chunk, chunk_bits, key, i;
+    uint8_t chunk_shift = bpc - 1 - SCAN_SPLIT_BITS;
+
+    for (plane = 0; plane < bpc; plane++) {
+        chunk_bits = (plane > chunk_shift) ? plane - chunk_shift : 0;
+        for (chunk = 0; chunk < (1u << chunk_bits); chunk++) {
+            // midpoint in 1 / 2^(SCAN_SPLIT_BITS + 1) of the frame, insert after equal keys
+            key = (2 * chunk + 1) << (SCAN_SPLIT_BITS - chunk_bits);
+            for (i = count; i > 0 && keys[i - 1] > key; i--) {
+                keys[i] = keys[i - 1];
+                planes[i] = planes[i - 1];
+                shifts[i] = shifts[i - 1];
+            }
+            keys[i] = key;
+            planes[i] = plane;
+            shifts[i] = plane - chunk_bits;
+            count++;
+        }
+    }
+    return count;
+}
+
+void scan_build_sched(SCAN_FRAME_T* frame, uint8_t brightness, uint8_t mode)
+{
+    uint32_t row, bit;
+    uint32_t slot = 0;
+    uint32_t set_mask;
+    uint32_t pio_delays = ((MAX_BRIGHTNESS - brightness) << 16) | brightness;
+    uint8_t planes[SCAN_ROW_SLOTS];
+    uint8_t shifts[SCAN_ROW_SLOTS];
+    uint32_t row_slots, i;
+
+    if (mode == SCAN_MODE_SPLIT) {
+        // Every row shows its next slot before any row shows the one after,
+        // so the rows are revisited several times per frame
+        row_slots = scan_split_slots(planes, shifts, frame->bpc);
+        for (i = 0; i < row_slots; i++) {
+            for (row = 0; row < LED_SUBPANEL_HEIGHT; row++) {
+                frame->sched[slot] = frame->data[row][planes[i]];
+                frame->ctrl[slot][0] = row_set_mask(row);
+                frame->ctrl[slot][1] = pio_delays << shifts[i];
+                slot++;
+            }
+        }
+    } else {
+        // Same order the cpu used to feed the state machines: each bit of a row, lsb first
+        for (row = 0; row < LED_SUBPANEL_HEIGHT; row++) {
+            set_mask = row_set_mask(row);
+            for (bit = 0; bit < frame->bpc; bit++) {
+                frame->sched[slot] = frame->data[row][bit];
+                frame->ctrl[slot][0] = set_mask;
+                frame->ctrl[slot][1] = pio_delays << bit;
+                slot++;
+            }
+        }
+    }
+    // a null trigger ends the frame, and raises the dma interrupt
+    frame->sched[slot] = NULL;
+}
+
+void inc_anim_seq(ANIM_SEQ_T* anim_seq, const uint8_t** src_data, int16_t* x, int16_t* y)
+{
+    ANIM_T* anim = &(anim_seq->anim[anim_seq->cur_anim]);
+
+    // increment animation
+    anim_seq->frame_count++;
+    anim->src_data.frame_count++;
+    anim->x.frame_count++;
+    anim->y.frame_count++;
+
+    if (anim->src_data.frame_count >= anim->src_data.frames_until_delta) {
+        anim->src_data.frame_count = 0;
+        *src_data += anim->src_data.delta;
+        anim->src_data.iteration_count++;
+        if (anim->src_data.iterations_until_restart != 0 && anim->src_data.iteration_count >= anim->src_data.iterations_until_restart) {
+            *src_data = anim->src_data.start_value;// anim->src_data.delta* anim->src_data.iteration_count;
+            anim->src_data.iteration_count = 0;
+        }
+    }
+
+    if (anim->x.frame_count >= anim->x.num_frames) {
+        anim->x.frame_count = 0;
+        *x += anim->x.delta;
+    }
+
+    if (anim->y.frame_count >= anim->y.num_frames) {
+        anim->y.frame_count = 0;
+        *y += anim->y.delta;
+    }
+
+    if (anim_seq->frame_count >= anim->num_frames) {
+        anim_seq->frame_count = 0;
+        anim_seq->cur_anim++;
+        if (anim_seq->cur_anim >= anim_seq->num_anim) {
+            anim_seq->cur_anim = 0;
+        }
+    }
+}
+
+void anim_backdrop(ANIM_SAVE_STATE_T* state)
+{
+    if (state->back_anim.num_anim == 0) return;
+    ANIM_T* anim = &(state->back_anim.anim[state->back_anim.cur_anim]);
+
+    // restart animation sequence
+    if (state->back_anim.frame_count == 0 && anim->src_data.start_value != NULL) {
+        state->backdrop.src_data = (uint32_t*)anim->src_data.start_value;
+        if (anim->width) state->backdrop.width = anim->width;
+        if (anim->pitch) state->backdrop.pitch = anim->pitch;
+        if (anim->height) state->backdrop.height = anim->height;
+        state->backdrop.x = anim->x.start_value;
+        state->backdrop.y = anim->y.start_value;
+        state->backdrop.format = anim->format;
+        state->backdrop.palette = anim->palette;
+        state->backdrop.tiles = anim->tiles;
+        anim->src_data.iteration_count = 0;
+        anim->src_data.frame_count = 0;
+        anim->x.frame_count = 0;
+        anim->y.frame_count = 0;
+    }
+
+    // increment animation
+    inc_anim_seq(&(state->back_anim), (const uint8_t**)&(state->backdrop.src_data), &(state->backdrop.x), &(state->backdrop.y));
+}
+
+void anim_layer(LAYER_T* layer)
+{
+    if (layer->anim.num_anim == 0) return;
+    ANIM_T* anim = &(layer->anim.anim[layer->anim.cur_anim]);
+
+    // restart animation sequence
+    if (layer->anim.frame_count == 0 && anim->src_data.start_value != NULL) {
+        layer->box.src_data = anim->src_data.start_value;
+        if (anim->width) layer->box.src_width = anim->width;
+        if (anim->height) layer->box.src_height = anim->height;
+        layer->box.offset_x = anim->x.start_value;
+        layer->box.offset_y = anim->y.start_value;
+        anim->src_data.iteration_count = 0;
+        anim->src_data.frame_count = 0;
+        anim->x.frame_count = 0;
+        anim->y.frame_count = 0;
+    }
+
+    // increment animation
+    inc_anim_seq(&(layer->anim), (const uint8_t**)&layer->box.src_data, &layer->box.offset_x, &layer->box.offset_y);
+}
+
+void anim_sprite(SPRITE_T* sprite)
+{
+    if (sprite->anim.num_anim == 0) return;
+    ANIM_T* anim = &(sprite->anim.anim[sprite->anim.cur_anim]);
+
+    // restart animation sequence
+    if (sprite->anim.frame_count == 0 && anim->src_data.start_value != NULL) {
+        sprite->src_data = (const uint16_t*)anim->src_data.start_value;
+        if (anim->width) sprite->width = anim->width;
+        if (anim->height) sprite->height = anim->height;
+        sprite->x = anim->x.start_value;
+        sprite->y = anim->y.start_value;
+        anim->src_data.iteration_count = 0;
+        anim->src_data.frame_count = 0;
+        anim->x.frame_count = 0;
+        anim->y.frame_count = 0;
+    }
+
+    // increment animation, which moves the sprite rather than scrolling its image
+    inc_anim_seq(&(sprite->anim), (const uint8_t**)&sprite->src_data, &sprite->x, &sprite->y);
+}
+
+// Time the animations have been stepped up to
+static uint64_t anim_time_us;
+static bool anim_time_valid = false;
+
+uint32_t anim_update(ANIM_SAVE_STATE_T* state, uint64_t now_us, bool step_backdrop, uint32_t step_layers, uint32_t step_sprites)
+{
+    uint32_t tick_us = (state->anim_tick_ms ? state->anim_tick_ms : ANIM_DEFAULT_TICK_MS) * 1000;
+    uint32_t ticks = 0;
+    uint32_t l;
+
+    if (!anim_time_valid) {
+        anim_time_us = now_us;
+        anim_time_valid = true;
+    }
+
+    // Step once per elapsed tick, so a late frame catches up instead of slowing the animation
+    while (now_us - anim_time_us >= tick_us && ticks < ANIM_MAX_CATCHUP) {
+        if (step_backdrop) anim_backdrop(state);
+        for (l = 0; l < MAX_LAYERS; l++) {
+            if (step_layers & (1u << l)) anim_layer(&state->layer[l]);
+        }
+        for (l = 0; l < MAX_SPRITES; l++) {
+            if (step_sprites & (1u << l)) anim_sprite(&state->sprite[l]);
+        }
+        anim_time_us += tick_us;
+        ticks++;
+    }
+
+    // Too far behind to catch up, so drop the missed ticks rather than rushing through them
+    if (now_us - anim_time_us >= tick_us) anim_time_us = now_us;
+
+    return ticks;
+}
+
+// What a sprite was drawn with, the fields of SPRITE_T ahead of its animation
+typedef struct RENDER_SPRITE_T_ {
+    bool enable;
+    uint8_t flags;
+    uint8_t priority;
+    int16_t x;
+    int16_t y;
+    int16_t width;
+    int16_t height;
+    const uint16_t* src_data;
+} RENDER_SPRITE_T;
+
+// Inputs of the last composed frame
+// The encoded frame is only rebuilt when these change, otherwise core1 keeps replaying it
+static BACKDROP_T render_backdrop;
+static IMG_BOX_T render_layer_box[MAX_LAYERS];
+static bool render_layer_enable[MAX_LAYERS];
+static RENDER_SPRITE_T render_sprite[MAX_SPRITES];
+static uint8_t render_brightness;
+static uint8_t render_scan_mode;
+static bool render_valid = false;
+
+// Set when a newer image than the last presented one is pending
+static bool render_pending = true;
+
+// Bit depth to encode with, and the dither phase of the next frame
+static uint8_t render_bpc = LED_MIN_BPC;
+static uint32_t render_phase = 0;
+
+RENDER_STATS_T render_stats;
+
+void render_mark_rows(uint32_t rows)
+{
+    int i;
+    // Each frame remembers which rows changed since it was last composed
+    for (i = 0; i < SCAN_NUM_FRAMES; i++) {
+        scan_frame[i].dirty_rows |= rows;
+    }
+    render_pending = true;
+}
+
+// Takes effect at the next render_update, along with the color correction
+void render_set_bpc(uint8_t bpc)
+{
+    render_bpc = bpc;
+}
+
+// Color of a coverage level of anti-aliased text, with its alpha from 0 to 32
+// premult is the color spread out as in blend_rgb565 and multiplied by alpha
+typedef struct TEXT_RAMP_T_ {
+    uint32_t premult;
+    uint16_t color;
+    uint8_t alpha;
+} TEXT_RAMP_T;
+
+#define MAX_TEXT_BPP 4
+#define MAX_TEXT_LEVELS (1 << MAX_TEXT_BPP)
+
+// Text of a layer, rasterized in the text cache
+// Colors and offsets are applied when sampling, so only the text, its size and font are kept
+typedef struct TEXT_CACHE_T_ {
+    bool valid;
+    const char* src_data;
+    const FONT_T* font;
+    int16_t src_width;
+    int16_t src_height;
+    uint32_t offset;  // in text_cache_pool
+    uint16_t stride;  // bytes per row
+    int32_t width;  // in pixels
+    int32_t height;
+    uint8_t bpp;  // bits of coverage per pixel
+    bool direct;  // no room in the pool, drawn from the font a glyph row at a time
+    TEXT_RAMP_T ramp[MAX_TEXT_LEVELS];  // anti-aliased text only, redone every frame
+} TEXT_CACHE_T;
+
+static uint8_t text_cache_pool[TEXT_CACHE_SIZE];
+static TEXT_CACHE_T text_cache[MAX_LAYERS];
+// A glyph row across the panel, for layers drawn without the pool
+static uint8_t text_line[(LED_PANEL_WIDTH * MAX_TEXT_BPP + 7) / 8];
+
+void render_invalidate()
+{
+    uint32_t l;
+
+    render_valid = false;
+    render_mark_rows(SCAN_ALL_ROWS);
+    for (l = 0; l < MAX_LAYERS; l++) {
+        text_cache[l].valid = false;
+    }
+}
+
+// Output rows covered by height panel rows from y
+static uint32_t render_span_rows(int32_t y, int32_t height)
+{
+    int32_t r;
+    int32_t r0 = (y < 0) ? 0 : y;
+    int32_t r1 = y + height;
+    uint32_t rows = 0;
+    if (r1 > LED_PANEL_HEIGHT) r1 = LED_PANEL_HEIGHT;
+    for (r = r0; r < r1; r++) {
+        rows |= 1u << (r % LED_SUBPANEL_HEIGHT);
+    }
+    return rows;
+}
+
+// Output rows an image box covers
+static inline uint32_t render_box_rows(const IMG_BOX_T* ibox)
+{
+    return render_span_rows(ibox->y, ibox->height);
+}
+
+// Output rows a layer covers, none when it's disabled
+static inline uint32_t render_layer_rows(const IMG_BOX_T* ibox, bool enable)
+{
+    return (enable && ibox->opacity) ? render_box_rows(ibox) : 0;
+}
+
+// Output rows a sprite covers, none when it's disabled
+static inline uint32_t render_sprite_rows(const SPRITE_T* sprite)
+{
+    return (sprite->enable && sprite->src_data) ? render_span_rows(sprite->y, sprite->height) : 0;
+}
+
+static inline uint32_t render_drawn_sprite_rows(const RENDER_SPRITE_T* sprite)
+{
+    return (sprite->enable && sprite->src_data) ? render_span_rows(sprite->y, sprite->height) : 0;
+}
+
+static inline bool render_sprite_changed(const RENDER_SPRITE_T* prev, const SPRITE_T* cur)
+{
+    return prev->enable != cur->enable || prev->flags != cur->flags || prev->priority != cur->priority ||
+        prev->x != cur->x || prev->y != cur->y || prev->width != cur->width || prev->height != cur->height ||
+        prev->src_data != cur->src_data;
+}
+
+static bool render_rle_step(const BACKDROP_T* prev, const BACKDROP_T* cur)
+{
+    return prev->format == IMG_FORMAT_RLE && cur->format == IMG_FORMAT_RLE && prev->src_data != cur->src_data &&
+        prev->x == cur->x && prev->y == cur->y && prev->width == cur->width && prev->height == cur->height;
+}
+
+static uint32_t render_rle_rows(const BACKDROP_T* prev, const BACKDROP_T* cur)
+{
+    int32_t r, img_row;
+    uint32_t rows = 0;
+
+    for (r = 0; r < LED_PANEL_HEIGHT; r++) {
+        img_row = (cur->y + r) % cur->height;
+        if (img_row < 0) img_row += cur->height;
+        if (rle_row(prev->src_data, img_row) != rle_row(cur->src_data, img_row)) {
+            rows |= 1u << (r % LED_SUBPANEL_HEIGHT);
+        }
+    }
+    return rows;
+}
+
+void render_invalidate_data(const ANIM_SAVE_STATE_T* anim, const void* start, const void* end)
+{
+    const uint8_t* data_start = (const uint8_t*)start;
+    const uint8_t* data_end = (const uint8_t*)end;
+    const uint8_t* src;
+    int32_t r, img_row;
+    uint32_t l;
+    uint32_t rows = 0;
+    uint8_t bits = img_format_bits(anim->backdrop.format);
+    uint32_t row_size = (anim->backdrop.width * bits + 7) >> 3;
+
+    // Backdrop rows whose source pixels were written, or all of them for its palette
+    // Run-length coded rows and tiles can be anywhere, so any write redraws them
+    src = (const uint8_t*)anim->backdrop.palette;
+    if (bits < 16 && src < data_end && src + (2u << bits) > data_start) {
+        rows = SCAN_ALL_ROWS;
+    }
+    if (anim->backdrop.format == IMG_FORMAT_RLE || anim->backdrop.format == IMG_FORMAT_TILES8 || anim->backdrop.format == IMG_FORMAT_TILES16) {
+        rows = SCAN_ALL_ROWS;
+    }
+    for (r = 0; r < LED_PANEL_HEIGHT; r++) {
+        img_row = (anim->backdrop.y + r) % anim->backdrop.height;
+        if (img_row < 0) img_row += anim->backdrop.height;
+        src = (const uint8_t*)(anim->backdrop.src_data + img_row * anim->backdrop.pitch);
+        if (src < data_end && src + row_size > data_start) {
+            rows |= 1u << (r % LED_SUBPANEL_HEIGHT);
+        }
+    }
+
+    // The whole box of each layer whose text or image was written
+    for (l = 0; l < MAX_LAYERS; l++) {
+        const IMG_BOX_T* ibox = &anim->layer[l].box;
+        uint32_t size = ibox->src_width * ibox->src_height;
+        if (!anim->layer[l].enable) continue;
+        src = (const uint8_t*)ibox->src_data;
+        if (!ibox->font) size *= 2;
+        if (src < data_end && src + size > data_start) {
+            rows |= render_box_rows(ibox);
+            text_cache[l].valid = false;
+        }
+    }
+
+    // Sprites whose image was written
+    for (l = 0; l < MAX_SPRITES; l++) {
+        const SPRITE_T* sprite = &anim->sprite[l];
+        src = (const uint8_t*)sprite->src_data;
+        if (src < data_end && src + 2 * sprite->width * sprite->height > data_start) {
+            rows |= render_sprite_rows(sprite);
+        }
+    }
+
+    if (rows) render_mark_rows(rows);
+}
+
+// Copies pixels of a binary upload out of the command stream, where they're big endian
+// A word at a time when the source allows it; lwIP payloads sit 2 bytes into a word
+void upload_pixels(uint16_t* dst, const uint8_t* src, uint32_t num_pixels)
+{
+    const uint16_t* src16;
+    uint32_t* dst32;
+    uint32_t w;
+
+    if (num_pixels && ((uintptr_t)dst & 2)) {
+        *dst++ = (src[0] << 8) | src[1];
+        src += 2;
+        num_pixels--;
+    }
+    dst32 = (uint32_t*)dst;
+    if (((uintptr_t)src & 3) == 0) {
+        for (; num_pixels >= 2; num_pixels -= 2) {
+            w = *(const uint32_t*)src;
+            *dst32++ = ((w >> 8) & 0x00ff00ff) | ((w << 8) & 0xff00ff00);
+            src += 4;
+        }
+    } else if (((uintptr_t)src & 1) == 0) {
+        src16 = (const uint16_t*)src;
+        for (; num_pixels >= 2; num_pixels -= 2) {
+            w = src16[0] | ((uint32_t)src16[1] << 16);
+            *dst32++ = ((w >> 8) & 0x00ff00ff) | ((w << 8) & 0xff00ff00);
+            src16 += 2;
+        }
+        src = (const uint8_t*)src16;
+    }
+    dst = (uint16_t*)dst32;
+    for (; num_pixels > 0; num_pixels--) {
+        *dst++ = (src[0] << 8) | src[1];
+        src += 2;
+    }
+}
+
+bool render_update(const ANIM_SAVE_STATE_T* anim)
+{
+    const LAYER_T* layer;
+    const SPRITE_T* sprite;
+    bool layer_changed;
+    uint32_t l;
+
+    // A new depth or correction needs new lookup tables, and every row encoded again
+    if (render_bpc != color_lut_bpc || anim->gamma != color_lut_gamma || anim->dither != color_lut_dither) {
+        init_color_lut(render_bpc, anim->gamma, anim->dither);
+        render_mark_rows(SCAN_ALL_ROWS);
+    }
+
+    // Dithering changes every row on every frame
+    if (anim->dither) {
+        render_mark_rows(SCAN_ALL_ROWS);
+    }
+
+    if (!render_valid) {
+        render_mark_rows(SCAN_ALL_ROWS);
+    } else {
+        // A backdrop move or switch affects every row, but stepping through run-length coded
+        // frames only affects the rows whose data changed
+        if (render_rle_step(&render_backdrop, &anim->backdrop)) {
+            render_mark_rows(render_rle_rows(&render_backdrop, &anim->backdrop));
+        } else if (memcmp(&render_backdrop, &anim->backdrop, sizeof(BACKDROP_T)) != 0) {
+            render_mark_rows(SCAN_ALL_ROWS);
+        }
+
+        // Only compare the layer configuration, not the sampling state
+        // Rows under both the old and the new box need to be redrawn
+        for (l = 0; l < MAX_LAYERS; l++) {
+            layer = &anim->layer[l];
+            layer_changed = render_layer_enable[l] != layer->enable;
+            layer_changed |= layer->enable && memcmp(&render_layer_box[l], &layer->box, offsetof(IMG_BOX_T, src_sample)) != 0;
+            if (layer_changed) {
+                render_mark_rows(render_layer_rows(&render_layer_box[l], render_layer_enable[l]) | render_layer_rows(&layer->box, layer->enable));
+            }
+        }
+
+        // Same for sprites, which mostly move or change frames
+        for (l = 0; l < MAX_SPRITES; l++) {
+            if (render_sprite_changed(&render_sprite[l], &anim->sprite[l])) {
+                render_mark_rows(render_drawn_sprite_rows(&render_sprite[l]) | render_sprite_rows(&anim->sprite[l]));
+            }
+        }
+
+        // brightness and modulation are only in the schedule, so no rows need to be redrawn
+        if (render_brightness != anim->brightness || render_scan_mode != anim->scan_mode) {
+            render_mark_rows(0);
+        }
+    }
+
+    memcpy(&render_backdrop, &anim->backdrop, sizeof(BACKDROP_T));
+    for (l = 0; l < MAX_LAYERS; l++) {
+        memcpy(&render_layer_box[l], &anim->layer[l].box, offsetof(IMG_BOX_T, src_sample));
+        render_layer_enable[l] = anim->layer[l].enable;
+    }
+    for (l = 0; l < MAX_SPRITES; l++) {
+        sprite = &anim->sprite[l];
+        render_sprite[l].enable = sprite->enable;
+        render_sprite[l].flags = sprite->flags;
+        render_sprite[l].priority = sprite->priority;
+        render_sprite[l].x = sprite->x;
+        render_sprite[l].y = sprite->y;
+        render_sprite[l].width = sprite->width;
+        render_sprite[l].height = sprite->height;
+        render_sprite[l].src_data = sprite->src_data;
+    }
+    render_brightness = anim->brightness;
+    render_scan_mode = anim->scan_mode;
+    render_valid = true;
+
+    return render_pending;
+}
+
+// Ors 8 bits, MSB first, into a cache row starting at bit x
+static inline void text_cache_put8(uint8_t* dst, uint16_t stride, int32_t x, uint8_t bits)
+{
+    uint32_t pair;
+
+    if (x < 0) {
+        if (x <= -8) return;
+        bits <<= -x;
+        x = 0;
+    }
+    pair = (uint32_t)bits << (8 - (x & 0x7));
+    if ((x >> 3) < stride) dst[x >> 3] |= pair >> 8;
+    if ((x >> 3) + 1 < stride) dst[(x >> 3) + 1] |= pair & 0xff;
+}
+
+// Ors glyph row fr of a row of text into dst, starting x pixels in
+// Proportional glyphs are placed by their advance, bearing and kerning
+static void text_raster_row(const FONT_T* f, const char* text, int16_t len, uint8_t bpp, int32_t fr, uint8_t* dst, uint16_t stride, int32_t x)
+{
+    const FONT_GLYPH_T* glyph;
+    const uint8_t* bits;
+    int32_t tc, b, o, bit, row_bits, row_bytes;
+    int32_t pen = x;
+
+    for (tc = 0; tc < len; tc++) {
+        if (!f->glyph_info) {
+            bits = f->glyphs + text[tc] * f->stride;
+            text_cache_put8(dst, stride, x + tc * f->width, bits[fr] & (0xff00 >> f->width));
+            continue;
+        }
+
+        glyph = font_glyph(f, text[tc]);
+        if (!glyph) continue;
+        if (tc > 0) pen += font_kern(f, text[tc - 1], text[tc]);
+        row_bits = glyph->width * bpp;
+        row_bytes = (row_bits + 7) >> 3;
+        bit = (pen + glyph->bearing) * bpp;
+        // glyphs outside of dst are only stepped over
+        if (bit < 8 * stride && bit + row_bits > 0) {
+            bits = f->glyphs + glyph->offset + fr * row_bytes;
+            for (b = 0; b < row_bytes; b++) {
+                // the last byte of a row may have bits past the glyph's width
+                o = 8 * b;
+                text_cache_put8(dst, stride, bit + o, (row_bits - o < 8) ? bits[b] & (0xff00 >> (row_bits - o)) : bits[b]);
+            }
+        }
+        pen += glyph->advance;
+    }
+}
+
+// Draws the whole text of a box into its cache, a glyph row at a time, once per text change
+static void text_cache_raster(TEXT_CACHE_T* cache, const IMG_BOX_T* ibox)
+{
+    const FONT_T* f = ibox->font;
+    uint8_t* dst;
+    int32_t tr, fr;
+
+    memset(text_cache_pool + cache->offset, 0, cache->stride * cache->height);
+    for (tr = 0; tr < ibox->src_height; tr++) {
+        dst = text_cache_pool + cache->offset + tr * f->height * cache->stride;
+        for (fr = 0; fr < f->height; fr++) {
+            text_raster_row(f, ibox->src_data + tr * ibox->src_width, ibox->src_width, cache->bpp, fr, dst + fr * cache->stride, cache->stride, 0);
+        }
+    }
+}
+
+// Draws the columns of glyph row r a span shows into text_line, for a layer with no room in the cache
+// The text repeats across the line at the width it wraps at, so the span reads the line from column 0
+static void text_line_raster(const TEXT_CACHE_T* cache, const IMG_BOX_T* ibox, int32_t r, int32_t x, int32_t cols)
+{
+    const FONT_T* f = ibox->font;
+    uint16_t stride = (cols * cache->bpp + 7) >> 3;
+    int32_t pen;
+
+    memset(text_line, 0, stride);
+    for (pen = -x; pen < cols; pen += cache->width) {
+        text_raster_row(f, ibox->src_data + (r / f->height) * ibox->src_width, ibox->src_width, cache->bpp, r % f->height, text_line, stride, pen);
+    }
+    render_stats.text_direct++;
+}
+
+// Colors of each coverage level, mixed with the background color if there is one and
+// otherwise blended over what's under the text, both as the opacity of the box says
+static void text_cache_ramp(TEXT_CACHE_T* cache, const IMG_BOX_T* ibox)
+{
+    uint32_t opacity = ibox->opacity + (ibox->opacity >> 7);  // 0 - 256
+    uint32_t levels = (1 << cache->bpp) - 1;
+    uint32_t k, cover, color;
+
+    for (k = 0; k <= levels; k++) {
+        cover = (k * 256) / levels;  // 0 - 256
+        if (ibox->bg_color != NO_BACKGROUND) {
+            cache->ramp[k].color = blend_rgb565(ibox->bg_color, ibox->fg_color, cover >> 3);
+            cache->ramp[k].alpha = (256 * opacity) >> 11;
+        } else {
+            cache->ramp[k].color = ibox->fg_color;
+            cache->ramp[k].alpha = (cover * opacity) >> 11;
+        }
+        color = (cache->ramp[k].color | ((uint32_t)cache->ramp[k].color << 16)) & 0x07e0f81f;
+        cache->ramp[k].premult = color * cache->ramp[k].alpha;
+    }
+}
+
+// Gives each enabled text layer its room in the cache, and lays out and rasterizes the ones that changed
+static void text_cache_update(const ANIM_SAVE_STATE_T* anim)
+{
+    const IMG_BOX_T* ibox;
+    TEXT_CACHE_T* cache;
+    uint32_t l, tr, width, row_width, stride, bpp;
+    uint32_t pos = 0;
+
+    for (l = 0; l < MAX_LAYERS; l++) {
+        ibox = &anim->layer[l].box;
+        cache = &text_cache[l];
+        if (!anim->layer[l].enable || !ibox->font || ibox->src_width <= 0 || ibox->src_height <= 0) {
+            cache->valid = false;
+            continue;
+        }
+        if (!cache->valid || cache->src_data != ibox->src_data || cache->font != ibox->font ||
+            cache->src_width != ibox->src_width || cache->src_height != ibox->src_height || cache->offset != pos) {
+            width = 0;
+            for (tr = 0; tr < ibox->src_height; tr++) {
+                row_width = font_text_width(ibox->font, ibox->src_data + tr * ibox->src_width, ibox->src_width);
+                if (row_width > width) width = row_width;
+            }
+            bpp = (ibox->font->bpp > 1) ? ibox->font->bpp : 1;
+            stride = (width * bpp + 7) >> 3;
+            if (width == 0) {
+                cache->valid = false;
+                continue;
+            }
+            cache->src_data = ibox->src_data;
+            cache->font = ibox->font;
+            cache->src_width = ibox->src_width;
+            cache->src_height = ibox->src_height;
+            cache->offset = pos;
+            cache->stride = stride;
+            cache->width = width;
+            cache->height = ibox->src_height * ibox->font->height;
+            cache->bpp = bpp;
+            // fixed fonts are drawn as before when the text doesn't fit, the others a glyph row at a time
+            cache->direct = pos + stride * cache->height > TEXT_CACHE_SIZE;
+            if (cache->direct && !ibox->font->glyph_info) {
+                cache->valid = false;
+                continue;
+            }
+            if (!cache->direct) {
+                text_cache_raster(cache, ibox);
+                render_stats.text_cached++;
+            }
+            cache->valid = true;
+        }
+        if (!cache->direct) pos += (cache->stride * cache->height + 3) & ~3;
+        if (cache->bpp > 1) text_cache_ramp(cache, ibox);
+    }
+}
+
+// Anti-aliased text, where each coverage level looks up its color in the ramp
+// Opaque levels are written as is, the rest take a multiply to blend with the line
+static inline void text_cache_span_aa(const TEXT_CACHE_T* cache, const uint8_t* bits, uint32_t* dst, int32_t x, int16_t col0, int16_t col1)
+{
+    uint32_t mask = (1 << cache->bpp) - 1;
+    const TEXT_RAMP_T* ramp;
+    uint32_t* word;
+    uint32_t b, shift, d;
+    int32_t c;
+
+    for (c = col0; c < col1; c++) {
+        b = x * cache->bpp;
+        ramp = &cache->ramp[(bits[b >> 3] >> (8 - cache->bpp - (b & 0x7))) & mask];
+        if (++x == cache->width) x = 0;
+        if (ramp->alpha == 32) {
+            line_put(dst, c, ramp->color);
+        } else if (ramp->alpha) {
+            word = dst + (c >> 2) * 4 + ((c >> 1) & 0x1);
+            shift = (c & 0x1) << 4;
+            d = (*word >> shift) & 0xffff;
+            d = (d | (d << 16)) & 0x07e0f81f;
+            d = ((d * (32 - ramp->alpha) + ramp->premult) >> 5) & 0x07e0f81f;
+            *word = (*word & ~(0xffffu << shift)) | ((d | (d >> 16)) & 0xffff) << shift;
+        }
+    }
+}
+
+// Same as ibox_span, for a text layer drawn from the cache, or from the font when it had no room there
+static inline void text_cache_span(const TEXT_CACHE_T* cache, const IMG_BOX_T* ibox, uint32_t* line, uint16_t row, int16_t col0, int16_t col1, bool blend)
+{
+    uint32_t opacity = ibox->opacity + (ibox->opacity >> 7);  // 0 - 256
+    int32_t j, r, c, x;
+    const uint8_t* bits;
+    uint8_t glyph;
+    uint16_t pixel;
+
+    for (j = 0; j < 2; j++) {
+        r = row + j * LED_SUBPANEL_HEIGHT - ibox->y;
+        if (r < 0 || r >= ibox->height) continue;
+        r = (r - ibox->offset_y) % cache->height;
+        if (r < 0) r += cache->height;
+        x = (col0 - ibox->x - ibox->offset_x) % cache->width;
+        if (x < 0) x += cache->width;
+        if (cache->direct) {
+            text_line_raster(cache, ibox, r, x, col1 - col0);
+            bits = text_line;
+            x = 0;
+        } else {
+            bits = text_cache_pool + cache->offset + r * cache->stride;
+        }
+
+        if (cache->bpp > 1) {
+            text_cache_span_aa(cache, bits, line + 2 * j, x, col0, col1);
+            continue;
+        }
+        for (c = col0; c < col1; c++) {
+            glyph = bits[x >> 3] << (x & 0x7);
+            if (++x == cache->width) x = 0;
+            if (glyph & 0x80) {
+                pixel = ibox->fg_color;
+            } else if (ibox->bg_color != NO_BACKGROUND) {
+                pixel = ibox->bg_color;
+            } else {
+                continue;
+            }
+            if (blend) {
+                ibox_put_blend(line + 2 * j, c, pixel, 256, opacity);
+            } else {
+                line_put(line + 2 * j, c, pixel);
+            }
+        }
+    }
+}
+
+// Builds the list of sprites of each row, in drawing order, once per frame
+// Sprites are ordered by priority, then index; past MAX_ROW_SPRITES, the last ones are left out
+static void render_sprite_lists(const ANIM_SAVE_STATE_T* anim, uint8_t row_sprites[][MAX_ROW_SPRITES], uint8_t* num_row_sprites)
+{
+    uint8_t order[MAX_SPRITES];
+    uint32_t i, j, r, rows;
+    uint32_t num_sprites = 0;
+
+    memset(num_row_sprites, 0, LED_SUBPANEL_HEIGHT);
+    for (i = 0; i < MAX_SPRITES; i++) {
+        if (!render_sprite_rows(&anim->sprite[i])) continue;
+        for (j = num_sprites; j > 0 && anim->sprite[order[j - 1]].priority > anim->sprite[i].priority; j--) {
+            order[j] = order[j - 1];
+        }
+        order[j] = i;
+        num_sprites++;
+    }
+
+    for (i = 0; i < num_sprites; i++) {
+        rows = render_sprite_rows(&anim->sprite[order[i]]);
+        for (r = 0; r < LED_SUBPANEL_HEIGHT; r++) {
+            if ((rows & (1u << r)) && num_row_sprites[r] < MAX_ROW_SPRITES) {
+                row_sprites[r][num_row_sprites[r]++] = order[i];
+            }
+        }
+    }
+}
+
+// Draws the part of a sprite on the top and bottom rows of a line
+static void render_sprite_row(const SPRITE_T* sprite, uint32_t* line, uint32_t row)
+{
+    int32_t j, r, c, c0, c1, src_col, step;
+    const uint16_t* src;
+    uint16_t pixel;
+
+    c0 = (sprite->x < 0) ? 0 : sprite->x;
+    c1 = sprite->x + sprite->width;
+    if (c1 > LED_PANEL_WIDTH) c1 = LED_PANEL_WIDTH;
+
+    for (j = 0; j < 2; j++) {
+        r = row + j * LED_SUBPANEL_HEIGHT - sprite->y;
+        if (r < 0 || r >= sprite->height) continue;
+        if (sprite->flags & SPRITE_FLIP_Y) r = sprite->height - 1 - r;
+        src = sprite->src_data + r * sprite->width;
+        src_col = c0 - sprite->x;
+        step = 1;
+        if (sprite->flags & SPRITE_FLIP_X) {
+            src_col = sprite->width - 1 - src_col;
+            step = -1;
+        }
+        for (c = c0; c < c1; c++) {
+            pixel = src[src_col];
+            if (pixel != NO_BACKGROUND) line_put(line + 2 * j, c, pixel);
+            src_col += step;
+        }
+    }
+}
+
+void compose_frame(SCAN_FRAME_T* frame, ANIM_SAVE_STATE_T* anim)
+{
+    uint32_t i, l;
+    const uint32_t* pixel0;
+    const uint32_t* pixel1;
+    uint32_t row;
+    int32_t img_row, img_row1, col, col0, col1;
+    IMG_BOX_T* ibox;
+    uint32_t line[LED_PANEL_WIDTH / 4][4];  // 4 columns of the top and bottom row per entry
+    uint32_t layer_rows[MAX_LAYERS];
+    uint32_t next_row[MAX_LAYERS];
+    uint8_t row_sprites[LED_SUBPANEL_HEIGHT][MAX_ROW_SPRITES];
+    uint8_t num_row_sprites[LED_SUBPANEL_HEIGHT];
+    uint32_t s;
+    bool blend;
+    uint32_t num_rows = 0;
+    uint8_t back_bits = anim->backdrop.palette ? img_format_bits(anim->backdrop.format) : 16;
+    uint8_t tile_shift = 0;
+
+    if (anim->backdrop.tiles) {
+        if (anim->backdrop.format == IMG_FORMAT_TILES8) tile_shift = 3;
+        if (anim->backdrop.format == IMG_FORMAT_TILES16) tile_shift = 4;
+    }
+
+    // Layers are culled per row, so the ones that don't cover a row cost nothing there
+    for (l = 0; l < MAX_LAYERS; l++) {
+        layer_rows[l] = render_layer_rows(&anim->layer[l].box, anim->layer[l].enable);
+        next_row[l] = ~0;
+    }
+    render_sprite_lists(anim, row_sprites, num_row_sprites);
+    text_cache_update(anim);
+
+    for (row = 0; row < LED_SUBPANEL_HEIGHT; row++) {
+        if (!(frame->dirty_rows & (1u << row))) continue;
+        num_rows++;
+
+        // Neighbouring rows start at different phases, so the dither doesn't pulse the whole panel
+        color_lut_cur = &color_lut[(render_phase + row) & (COLOR_DITHER_PHASES - 1)];
+
+        col = (anim->backdrop.x % anim->backdrop.width);
+        if (col < 0) col += anim->backdrop.width;
+        img_row = (anim->backdrop.y + row) % anim->backdrop.height;
+        if (img_row < 0) img_row += anim->backdrop.height;
+        img_row1 = (img_row + LED_SUBPANEL_HEIGHT) % anim->backdrop.height;
+        pixel0 = anim->backdrop.src_data + (img_row * anim->backdrop.pitch);
+        pixel1 = anim->backdrop.src_data + (img_row1 * anim->backdrop.pitch);
+        if (tile_shift) {
+            // map rows are a whole number of words, like the rows of the other formats
+            read_line_tiles(line[0], (const uint16_t*)(anim->backdrop.src_data + (img_row >> tile_shift) * anim->backdrop.pitch),
+                img_row & ((1u << tile_shift) - 1), col, anim->backdrop.width, tile_shift, anim->backdrop.tiles);
+            read_line_tiles(line[0] + 2, (const uint16_t*)(anim->backdrop.src_data + (img_row1 >> tile_shift) * anim->backdrop.pitch),
+                img_row1 & ((1u << tile_shift) - 1), col, anim->backdrop.width, tile_shift, anim->backdrop.tiles);
+        } else if (anim->backdrop.format == IMG_FORMAT_RLE) {
+            read_line_rle(line[0], rle_row(anim->backdrop.src_data, img_row), col, anim->backdrop.width);
+            read_line_rle(line[0] + 2, rle_row(anim->backdrop.src_data, img_row1), col, anim->backdrop.width);
+        } else if (back_bits < 16) {
+            // the palette lookup fills the line with RGB565, so layers and the encoder don't change
+            read_line_indexed(line[0], pixel0, col, anim->backdrop.width, back_bits, anim->backdrop.palette);
+            read_line_indexed(line[0] + 2, pixel1, col, anim->backdrop.width, back_bits, anim->backdrop.palette);
+        } else {
+            for (i = 0; i < LED_PANEL_WIDTH; i += 4) {
+                read_color(line[i >> 2], pixel0, col, anim->backdrop.width);
+                read_color(line[i >> 2] + 2, pixel1, col, anim->backdrop.width);
+                col += 4;
+                if (col >= anim->backdrop.width) col -= anim->backdrop.width;
+            }
+        }
+
+        // Layers in z-order, each over the columns its box covers, with the sprites of
+        // each priority under the layer of the same number
+        s = 0;
+        for (l = 0; l < MAX_LAYERS; l++) {
+            for (; s < num_row_sprites[row] && anim->sprite[row_sprites[row][s]].priority <= l; s++) {
+                render_sprite_row(&anim->sprite[row_sprites[row][s]], line[0], row);
+            }
+            if (!(layer_rows[l] & (1u << row))) continue;
+            ibox = &anim->layer[l].box;
+            col0 = (ibox->x < 0) ? 0 : ibox->x;
+            col1 = ibox->x + ibox->width;
+            if (col1 > LED_PANEL_WIDTH) col1 = LED_PANEL_WIDTH;
+            // only layers that are see-through somewhere pay for blending
+            blend = ibox->opacity != MAX_OPACITY || (!ibox->font && ibox->format != IMG_FORMAT_RGB565);
+            if (text_cache[l].valid) {
+                if (col0 < col1) text_cache_span(&text_cache[l], ibox, line[0], row, col0, col1, blend);
+                continue;
+            }
+            // proportional text that isn't in the cache has no glyph to draw
+            if (ibox->font && ibox->font->glyph_info) continue;
+            // a box is stepped a row at a time, so only reset it after skipping rows
+            if (row != next_row[l]) ibox_reset_row(ibox, row);
+            next_row[l] = row + 1;
+            if (col0 < col1) {
+                if (blend) {
+                    ibox_span_blend(ibox, line[0], row, col0, col1);
+                } else {
+                    ibox_span(ibox, line[0], row, col0, col1);
+                }
+            }
+            ibox_inc_row(ibox);
+        }
+        for (; s < num_row_sprites[row]; s++) {
+            render_sprite_row(&anim->sprite[row_sprites[row][s]], line[0], row);
+        }
+
+        for (i = 0; i < LED_PANEL_WIDTH; i += 4) {
+            parse_color(frame->data[row][0] + (i >> 2), line[i >> 2]);
+        }
+    }
+    frame->dirty_rows = 0;
+    frame->bpc = color_lut_bpc;
+    scan_build_sched(frame, anim->brightness, anim->scan_mode);
+    if (color_lut_dither) render_phase++;
+
+    render_pending = false;
+    render_stats.frames++;
+    render_stats.rows += num_rows;
+    render_stats.last_rows = num_rows;
+}
@@ -0,0 +1,374 @@
+//
+// LED Matrix compositor
+// Panel layout, animation state and encoded frames, without any Pico SDK dependency
+// so the compositor can also be built and measured on the host
+//
+
+#ifndef __LED_RENDER_H
+#define __LED_RENDER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include "font.h"
+
+// These map the GPIO pins to the HUB75 ports
+// Color data can be any pin, must be within a contiguous 8
+static const uint8_t HUB75_R0 = 2;
+static const uint8_t HUB75_G0 = 3;
+static const uint8_t HUB75_B0 = 4;
+static const uint8_t HUB75_R1 = 5;
+static const uint8_t HUB75_G1 = 8;
+static const uint8_t HUB75_B1 = 9;
+// Address pins can be, but a given An pin, the pin must >= n
+// (ie, A1 cannot be pin 0, A2 cannot be pin 0 or 1, etc)
+// This requirement can be removed, but requires an additional shift
+// per address bit in the row_set_mask/row_clr_mask fuctions
+static const uint8_t HUB75_A4 = 22;
+static const uint8_t HUB75_A0 = 10;
+static const uint8_t HUB75_A1 = 16;
+static const uint8_t HUB75_A2 = 18;
+static const uint8_t HUB75_A3 = 20;
+// CLK can be any pin
+static const uint8_t HUB75_CLK = 11;
+// Latch and Blank must be consecutive pins, with Latch beign first
+// Blank can be first, but requires some changes in the sm_ctrl pio program
+static const uint8_t HUB75_LATCH = 12;
+static const uint8_t HUB75_BLANK = 13;
+
+// find minimum address pin
+static const uint8_t HUB75_A0A1_BASE = (HUB75_A1 < HUB75_A0) ? HUB75_A1 : HUB75_A0;
+static const uint8_t HUB75_A2A3_BASE = (HUB75_A3 < HUB75_A2) ? HUB75_A3 : HUB75_A2;
+static const uint8_t HUB75_A0123_BASE = (HUB75_A2A3_BASE < HUB75_A0A1_BASE) ? HUB75_A2A3_BASE : HUB75_A0A1_BASE;
+static const uint8_t HUB75_ADDR_BASE = (HUB75_A4 < HUB75_A0123_BASE) ? HUB75_A4 : HUB75_A0123_BASE;
+
+// find maximum address pin
+static const uint8_t HUB75_A0A1_MAX = (HUB75_A1 > HUB75_A0) ? HUB75_A1 : HUB75_A0;
+static const uint8_t HUB75_A2A3_MAX = (HUB75_A3 > HUB75_A2) ? HUB75_A3 : HUB75_A2;
+static const uint8_t HUB75_A0123_MAX = (HUB75_A2A3_MAX > HUB75_A0A1_MAX) ? HUB75_A2A3_MAX : HUB75_A0A1_MAX;
+static const uint8_t HUB75_ADDR_MAX = (HUB75_A4 > HUB75_A0123_MAX) ? HUB75_A4 : HUB75_A0123_MAX;
+
+// find num pins within the address pin range
+static const uint8_t HUB75_ADDR_PIN_RANGE = HUB75_ADDR_MAX - HUB75_ADDR_BASE + 1;
+
+// Find the minimum of all of the pins
+static const uint8_t HUB75_COLOR0_BASE = (HUB75_R0 < HUB75_G0) ? ((HUB75_R0 < HUB75_B0) ? HUB75_R0 : HUB75_B0) : ((HUB75_G0 < HUB75_B0) ? HUB75_G0 : HUB75_B0);
+static const uint8_t HUB75_COLOR1_BASE = (HUB75_R1 < HUB75_G1) ? ((HUB75_R1 < HUB75_B1) ? HUB75_R1 : HUB75_B1) : ((HUB75_G1 < HUB75_B1) ? HUB75_G1 : HUB75_B1);
+static const uint8_t HUB75_COLOR_BASE = (HUB75_COLOR0_BASE < HUB75_COLOR1_BASE) ? HUB75_COLOR0_BASE : HUB75_COLOR1_BASE;
+
+// LED panel resolution within a daisy chain
+// These size the scanout buffers, so must be macros
+#define LED_PANEL_WIDTH 128
+#define LED_PANEL_HEIGHT 32
+
+// The desired refresh of the panel in Hz
+static const uint32_t LED_REFRESH_HZ = 100;
+
+// Period of the panel refresh in usec
+static const uint32_t LED_REFRESH_PERIOD_USEC = 1000000 / LED_REFRESH_HZ;
+
+// Range of bits per component, selectable at runtime
+// The scanout buffers are sized for the maximum
+#define LED_MIN_BPC 4
+#define LED_MAX_BPC 8
+
+// number of rows of panels chained together
+#define LED_PANEL_ROWS 1
+
+// the true height of each panel
+#define LED_PHYSICAL_HEIGHT (LED_PANEL_HEIGHT / LED_PANEL_ROWS)
+
+// indicates height of the subpanel interleave
+#define LED_SUBPANEL_HEIGHT (LED_PHYSICAL_HEIGHT / 2)
+
+// number of pio control instructions outside of the main on/off delay loops
+// these instructions will keep the LED off, so the maximum brightness will be reduced by this much
+static const uint32_t PIO_CTRL_INSTRUCTIONS = 6;
+
+// number of cycles in each control loop for each bit/row
+// This affects the maximum brightness granulrity
+static const uint32_t PIO_CTRL_CYCLES = 256;
+
+// maximum brightness level
+static const uint32_t MAX_BRIGHTNESS = PIO_CTRL_CYCLES - PIO_CTRL_INSTRUCTIONS;
+
+// pio cycles to complete a row or frame, which double with every bit per component
+static const uint32_t MIN_CYCLES_PER_BIT = PIO_CTRL_CYCLES;
+#define CYCLES_PER_ROW(bpc) (MIN_CYCLES_PER_BIT << (bpc))
+#define CYCLES_PER_FRAME(bpc) (CYCLES_PER_ROW(bpc) * LED_SUBPANEL_HEIGHT)
+
+// RGB masks
+static const uint32_t LED_SRC_565_R_MASK_LO = 0xf800;
+static const uint32_t LED_SRC_565_G_MASK_LO = 0x07e0;
+static const uint32_t LED_SRC_565_B_MASK_LO = 0x001f;
+static const uint32_t LED_SRC_565_R_MASK_HI = (LED_SRC_565_R_MASK_LO << 16);
+static const uint32_t LED_SRC_565_G_MASK_HI = (LED_SRC_565_G_MASK_LO << 16);
+static const uint32_t LED_SRC_565_B_MASK_HI = (LED_SRC_565_B_MASK_LO << 16);
+static const uint32_t LED_SRC_565_R_MASK = LED_SRC_565_R_MASK_HI | LED_SRC_565_R_MASK_LO;
+static const uint32_t LED_SRC_565_G_MASK = LED_SRC_565_G_MASK_HI | LED_SRC_565_G_MASK_LO;
+static const uint32_t LED_SRC_565_B_MASK = LED_SRC_565_B_MASK_HI | LED_SRC_565_B_MASK_LO;
+
+static const uint32_t BLACK[4] = { 0 };
+
+// Number of frames temporal dithering spreads the low bits over, must be a power of 2
+#define COLOR_DITHER_PHASES 4
+
+// Gamma that leaves the colors uncorrected, each component's top bits shown as they are
+static const uint16_t COLOR_GAMMA_RAW = 0xffff;
+
+// Modulation schemes of the scanout
+#define SCAN_MODE_BCM 0    // each bitplane of a row in one slot, lsb first
+#define SCAN_MODE_SPLIT 1  // the top bitplanes split into shorter slots, scattered over the frame
+
+// Number of top bitplanes split mode breaks up; the msb becomes 2^SCAN_SPLIT_BITS slots
+#define SCAN_SPLIT_BITS 2
+
+// Most row/bit slots a row takes, in split mode at the deepest bit depth
+#define SCAN_ROW_SLOTS (LED_MAX_BPC + (1 << (SCAN_SPLIT_BITS + 1)) - 2 - SCAN_SPLIT_BITS)
+
+// Number of row/bit slots the scanout goes through each frame
+#define SCAN_SLOTS (LED_SUBPANEL_HEIGHT * SCAN_ROW_SLOTS)
+
+// Mask of all rows in a frame
+#define SCAN_ALL_ROWS ((uint32_t)((1ull << LED_SUBPANEL_HEIGHT) - 1))
+
+// Number of encoded frames; one is scanned out by core1 and core0 composes into the other
+// core0 composes at most once per frame boundary, where core1 takes up the frame presented
+// before, so the one it composes into is never scanned out or waiting to be
+#define SCAN_NUM_FRAMES 2
+
+// Words the dma sends to each state machine per slot: a bitplane of a row, 4 columns to a word,
+// and the row address and on/off delays
+#define SCAN_DATA_WORDS (LED_PANEL_WIDTH / 4)
+#define SCAN_CTRL_WORDS 2
+
+// An encoded frame, as streamed out by dma
+// Each slot sends one bitplane of a row to the data state machine,
+// followed by the row address and on/off delays to the ctrl state machine
+typedef struct SCAN_FRAME_T_ {
+    uint32_t data[LED_SUBPANEL_HEIGHT][LED_MAX_BPC][SCAN_DATA_WORDS];
+    const uint32_t* sched[SCAN_SLOTS + 1];  // data block for each slot, NULL terminated
+    uint32_t ctrl[SCAN_SLOTS][SCAN_CTRL_WORDS];  // row address and delays for each slot
+    uint32_t dirty_rows;                    // rows changed since this frame was composed
+    uint8_t bpc;                            // bitplanes per row, the scanout clocks follow it
+} SCAN_FRAME_T;
+
+// Compositor counters, to see how much work each change costs
+typedef struct RENDER_STATS_T_ {
+    uint32_t frames;     // frames composed
+    uint32_t rows;       // rows composed, over all frames
+    uint32_t last_rows;  // rows composed in the last frame
+    uint32_t text_cached;  // text layers rasterized into the text cache
+    uint32_t text_direct;  // rows of text drawn from the font, for layers with no room in the cache
+} RENDER_STATS_T;
+
+// Bytes of RAM text layers are rasterized into, at 1 bit per pixel, so composing doesn't
+// go through the characters and font tables for every pixel
+// Layers are given room in order; the ones that don't fit are drawn from the font, proportional
+// and anti-aliased ones a glyph row at a time for each row they cover
+#ifndef TEXT_CACHE_SIZE
+#define TEXT_CACHE_SIZE (4 * 1024)
+#endif
+
+#define MAX_ANIM 8
+
+// Animations step once per tick; the frame counts of an ANIM_T are in ticks
+// The default matches the original 100 Hz refresh, so older uploads keep their speed
+#define ANIM_DEFAULT_TICK_MS 10
+
+// Most ticks stepped at once to catch up with a late frame
+#define ANIM_MAX_CATCHUP 32
+
+// Pixel formats of images, text layers always use the box colors
+// Palette formats index a table of RGB565 colors, packed from the low bits of each word up
+// Palette and run-length formats are only read by the backdrop; ARGB4444 is only read by layers
+static const uint8_t IMG_FORMAT_RGB565 = 0;
+static const uint8_t IMG_FORMAT_ARGB4444 = 1;  // 4 bit alpha in the top bits, 0 is transparent
+static const uint8_t IMG_FORMAT_PAL8 = 2;
+static const uint8_t IMG_FORMAT_PAL4 = 3;
+static const uint8_t IMG_FORMAT_PAL2 = 4;
+static const uint8_t IMG_FORMAT_RLE = 5;
+static const uint8_t IMG_FORMAT_TILES8 = 6;  // tilemaps of 8x8 and 16x16 tiles
+static const uint8_t IMG_FORMAT_TILES16 = 7;
+
+// Run-length coded frames, as written by led-rle
+// The backdrop points at an entry in a table of int32 byte offsets, one per frame, from the entry to
+// the frame, so an animation steps through the frames with a delta of 4
+// A frame is a table of int32 byte offsets, one per row, from the table to the row's data
+// Rows that didn't change point back to the data of an earlier frame
+// Row data is uint16 tokens; a count with RLE_RUN set is followed by one color repeated that
+// many times, otherwise by that many RGB565 pixels
+static const uint16_t RLE_RUN = 0x8000;
+static const uint16_t RLE_MAX_COUNT = 0x7fff;
+
+// Tilemaps are rows of uint16 tile indices, with the width and height of the backdrop in pixels
+// Tiles are RGB565 and stored one after the other in an atlas, so tile n starts at pixel n * size * size
+
+// Layer opacity that skips blending
+static const uint8_t MAX_OPACITY = 255;
+
+typedef struct ANIM_PARAM_T_ {
+    int16_t start_value;
+    int16_t delta;
+    int16_t num_frames;
+    int16_t frame_count;
+} ANIM_PARAM_T;
+
+typedef struct ANIM_PARAM_PTR_T_ {
+    const char* start_value;
+    int32_t delta;
+    int16_t frames_until_delta;
+    int16_t iterations_until_restart;
+    int16_t frame_count;
+    int16_t iteration_count;
+} ANIM_PARAM_PTR_T;
+
+typedef struct ANIM_T_ {
+    int16_t width;
+    int16_t pitch;
+    int16_t height;
+    ANIM_PARAM_PTR_T src_data;
+    ANIM_PARAM_T x;
+    ANIM_PARAM_T y;
+    int16_t num_frames;
+    uint8_t format;  // of the backdrop while this animation plays
+    const uint16_t* palette;
+    const uint16_t* tiles;
+} ANIM_T;
+
+typedef struct ANIM_SEQ_T_ {
+    ANIM_T anim[MAX_ANIM];
+    uint8_t num_anim;
+    uint8_t cur_anim;
+    int16_t frame_count;
+} ANIM_SEQ_T;
+
+typedef struct BACKDROP_T_{
+    const uint32_t* src_data;
+    int16_t x;
+    int16_t y;
+    uint16_t width;
+    uint16_t pitch;  // in words
+    uint16_t height;
+    uint8_t format;  // IMG_FORMAT_RGB565, a palette, run-length or tilemap format
+    const uint16_t* palette;
+    const uint16_t* tiles;  // atlas of the tilemap formats
+} BACKDROP_T;
+
+typedef struct IMG_BOX_T_ {
+    const char* src_data;
+    const FONT_T* font;
+    int16_t x;
+    int16_t y;
+    int16_t width;
+    int16_t height;
+    int16_t offset_x;
+    int16_t offset_y;
+    int16_t src_width;
+    int16_t src_height;
+    uint16_t fg_color;
+    uint16_t bg_color;
+    uint8_t format;  // IMG_FORMAT_RGB565 or IMG_FORMAT_ARGB4444
+    uint8_t opacity;  // of the whole layer, MAX_OPACITY for none
+    const uint8_t* src_sample[2];
+    int32_t src_row_index[2];
+    int16_t font_row[2];
+    int32_t src_col_index;
+    int16_t font_col;
+} IMG_BOX_T;
+
+// Number of layers drawn over the backdrop
+#define MAX_LAYERS 8
+#define ALL_LAYERS ((1u << MAX_LAYERS) - 1)
+
+// A text or image layer, with its own animation
+typedef struct LAYER_T_ {
+    bool enable;
+    IMG_BOX_T box;
+    ANIM_SEQ_T anim;
+} LAYER_T;
+
+// Sprites, small images placed anywhere over the backdrop, like the hardware sprites of old consoles
+// Each row only visits the sprites that cover it, up to MAX_ROW_SPRITES
+// In led-bench a 16 pixel wide sprite costs about 3% of reading a backdrop row, and a text layer
+// about 20 times that, so a full row of sprites adds about a quarter to the compose time of a row
+#define MAX_SPRITES 16
+#define ALL_SPRITES ((1u << MAX_SPRITES) - 1)
+#define MAX_ROW_SPRITES 8
+
+static const uint8_t SPRITE_FLIP_X = 0x1;
+static const uint8_t SPRITE_FLIP_Y = 0x2;
+
+// Pixels are RGB565, with NO_BACKGROUND left transparent
+typedef struct SPRITE_T_ {
+    bool enable;
+    uint8_t flags;  // SPRITE_FLIP_X, SPRITE_FLIP_Y
+    uint8_t priority;  // number of layers drawn under it, MAX_LAYERS puts it above all of them
+    int16_t x;
+    int16_t y;
+    int16_t width;
+    int16_t height;
+    const uint16_t* src_data;
+    ANIM_SEQ_T anim;  // steps src_data through frames, and moves the sprite
+} SPRITE_T;
+
+// Changes with the layout of the scene, so scenes saved in an older one aren't loaded
+static const uint8_t ANIM_SIG = 0xE6;
+
+typedef struct ANIM_SAVE_STATE_T_ {
+    uint8_t signature;
+    uint8_t brightness;
+    uint8_t bpc;  // requested bits per component, 0 picks the highest that keeps the refresh rate
+    bool dither;  // spread the bits below the bit depth over successive frames
+    uint16_t gamma;  // in hundredths, 0 for the CIE1931 lightness curve, COLOR_GAMMA_RAW for none
+    uint8_t scan_mode;  // SCAN_MODE_BCM or SCAN_MODE_SPLIT
+    uint16_t anim_tick_ms;  // animation tick, 0 for ANIM_DEFAULT_TICK_MS
+    BACKDROP_T backdrop;
+    ANIM_SEQ_T back_anim;
+    LAYER_T layer[MAX_LAYERS];  // drawn in order over the backdrop, the last one on top
+    SPRITE_T sprite[MAX_SPRITES];  // drawn in order within the same priority
+} ANIM_SAVE_STATE_T;
+
+// Color encoding functions
+void init_color_lut(uint8_t bpc, uint16_t gamma, bool dither);
+void parse_color(uint32_t* dst_data, const uint32_t* src_color);
+void read_color(uint32_t* src_color, const uint32_t* src_color_row, uint32_t col, uint32_t width);
+void read_line_indexed(uint32_t* dst, const uint32_t* src_color_row, uint32_t col, uint32_t width, uint8_t bits, const uint16_t* palette);
+void read_line_rle(uint32_t* dst, const uint16_t* src, uint32_t col, uint32_t width);
+const uint16_t* rle_row(const uint32_t* src, int32_t row);
+void read_line_tiles(uint32_t* dst, const uint16_t* map_row, uint32_t tile_row, uint32_t col, uint32_t width, uint8_t tile_shift, const uint16_t* tiles);
+uint8_t img_format_bits(uint8_t format);
+
+// Image box functions
+void ibox_set_sample(IMG_BOX_T* ibox);
+void ibox_reset_row(IMG_BOX_T* ibox, uint16_t row);
+void ibox_reset_col(IMG_BOX_T* ibox, int16_t col);
+void ibox_inc_row(IMG_BOX_T* ibox);
+void ibox_inc_col(IMG_BOX_T* ibox);
+void ibox_span(IMG_BOX_T* ibox, uint32_t* line, uint16_t row, int16_t col0, int16_t col1);
+void ibox_span_blend(IMG_BOX_T* ibox, uint32_t* line, uint16_t row, int16_t col0, int16_t col1);
+
+// Schedule functions
+uint32_t row_set_mask(uint8_t row);
+void scan_build_sched(SCAN_FRAME_T* frame, uint8_t brightness, uint8_t mode);
+
+// Animation functions
+void inc_anim_seq(ANIM_SEQ_T* anim_seq, const uint8_t** src_data, int16_t* x, int16_t* y);
+void anim_backdrop(ANIM_SAVE_STATE_T* state);
+void anim_layer(LAYER_T* layer);
+void anim_sprite(SPRITE_T* sprite);
+uint32_t anim_update(ANIM_SAVE_STATE_T* state, uint64_t now_us, bool step_backdrop, uint32_t step_layers, uint32_t step_sprites);
+
+// Upload functions
+void upload_pixels(uint16_t* dst, const uint8_t* src, uint32_t num_pixels);
+
+// Compositing functions
+void render_set_bpc(uint8_t bpc);
+void render_mark_rows(uint32_t rows);
+void render_invalidate();
+void render_invalidate_data(const ANIM_SAVE_STATE_T* anim, const void* start, const void* end);
+bool render_update(const ANIM_SAVE_STATE_T* anim);
+void compose_frame(SCAN_FRAME_T* frame, ANIM_SAVE_STATE_T* anim);
+
+#endif  // __LED_RENDER_H
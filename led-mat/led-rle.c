@@ -0,0 +1,78 @@
+// Run-length encoder for backdrop animations
+// Reads raw RGB565 frames, little endian and back to back, and writes them as IMG_FORMAT_RLE,
+// ready to be uploaded into image_data with @D
+// Play them back with a backdrop animation starting at the upload offset, stepping the source
+// by 4 every frame and restarting after the number of frames, with @Y setting IMG_FORMAT_RLE
+// usage: led-rle width height input output
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "led-render.h"
+#include "led-encode.h"
+
+int main(int argc, char** argv)
+{
+    FILE* file;
+    long size;
+    uint32_t width, height, num_frames;
+    uint16_t* frames;
+    uint8_t* dst;
+    size_t dst_size, encoded;
+
+    if (argc != 5) {
+        printf("usage: %s width height input output\n", argv[0]);
+        return 1;
+    }
+    width = strtoul(argv[1], NULL, 0);
+    height = strtoul(argv[2], NULL, 0);
+    if (width == 0 || height == 0) {
+        printf("width and height must not be 0\n");
+        return 1;
+    }
+
+    file = fopen(argv[3], "rb");
+    if (!file) {
+        printf("can't open %s\n", argv[3]);
+        return 1;
+    }
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    num_frames = size / (2 * width * height);
+    if (num_frames == 0) {
+        printf("%s holds less than a frame\n", argv[3]);
+        fclose(file);
+        return 1;
+    }
+    frames = malloc((size_t)num_frames * width * height * 2);
+    if (fread(frames, 2 * width * height, num_frames, file) != num_frames) {
+        printf("can't read %s\n", argv[3]);
+        fclose(file);
+        return 1;
+    }
+    fclose(file);
+
+    // worst case, a literal token per pixel
+    dst_size = 4 * (size_t)num_frames * (height + 1) + (size_t)num_frames * height * (4 * width + 4);
+    dst = malloc(dst_size);
+    encoded = rle_encode(dst, dst_size, frames, width, height, num_frames);
+    if (encoded == 0) {
+        printf("encoding failed\n");
+        return 1;
+    }
+
+    file = fopen(argv[4], "wb");
+    if (!file || fwrite(dst, 1, encoded, file) != encoded) {
+        printf("can't write %s\n", argv[4]);
+        return 1;
+    }
+    fclose(file);
+
+    printf("%lu frames of %lux%lu, raw %lu bytes, encoded %lu bytes (%.1f%%)\n",
+        (unsigned long)num_frames, (unsigned long)width, (unsigned long)height,
+        (unsigned long)num_frames * width * height * 2, (unsigned long)encoded,
+        100.0 * encoded / ((double)num_frames * width * height * 2));
+    free(frames);
+    free(dst);
+    return 0;
+}
@@ -0,0 +1,230 @@
+// Driver for led matrix for PICO W
+// Scanout of encoded frames to the hub75 state machines using dma
+
+#include "led-mat.h"
+#include "hub75.pio.h"
+
+extern SCAN_FRAME_T scan_frame[SCAN_NUM_FRAMES];
+
+static PIO scan_pio;
+static uint scan_sm_data;
+static uint scan_sm_ctrl;
+
+// dma channels
+// sched writes the next data block address to data, which triggers it
+// data sends a block to the data sm, then chains to ctrl
+// ctrl sends the address/delays to the ctrl sm, then chains back to sched
+static int scan_dma_sched;
+static int scan_dma_data;
+static int scan_dma_ctrl;
+
+// frame currently being scanned out, and the frame to switch to at the end of it
+// core1 moves ready to front, core0 fills ready; both under scan_lock
+static volatile int8_t scan_front = 0;
+static volatile int8_t scan_ready = -1;
+static spin_lock_t* scan_lock;
+
+// number of frames scanned out, used to pace the animations
+static volatile uint32_t scan_frames = 0;
+
+// state machine clocks for each bit depth, and the deepest one that keeps LED_REFRESH_HZ
+static SCAN_TIMING_T scan_timing[LED_MAX_BPC + 1];
+static uint8_t scan_auto_bpc = LED_MIN_BPC;
+
+// bit depth the state machine clocks are currently set up for
+static uint8_t scan_bpc;
+
+static void scan_init_timing(uint8_t bpc)
+{
+    SCAN_TIMING_T* timing = &scan_timing[bpc];
+    float sys_freq = (float)clock_get_hz(clk_sys);
+    float ctrl_freq = PIO_CTRL_FREQ(bpc);
+    float data_freq = PIO_DATA_FREQ(bpc);
+    float scale = 1.0f;
+    float div;
+
+    // Slow both machines down together when the data machine can't keep up
+    // The data machine always runs faster, so it also keeps the ctrl divider >= 1
+    if (data_freq > PIO_DATA_MAX_FREQ) scale = PIO_DATA_MAX_FREQ / data_freq;
+    if (data_freq * scale > sys_freq) scale = sys_freq / data_freq;
+    if (scale >= 1.0f) scan_auto_bpc = bpc;
+
+    div = sys_freq / (ctrl_freq * scale);
+    timing->ctrl_div_int = div;
+    timing->ctrl_div_frac = (div - timing->ctrl_div_int) * 256.0f;
+    div = sys_freq / (data_freq * scale);
+    timing->data_div_int = div;
+    timing->data_div_frac = (div - timing->data_div_int) * 256.0f;
+
+    // Report the refresh the quantized divider actually gives
+    div = timing->ctrl_div_int + timing->ctrl_div_frac / 256.0f;
+    timing->refresh_dhz = 10.0f * sys_freq / (div * CYCLES_PER_FRAME(bpc));
+}
+
+static inline void scan_set_timing(uint8_t bpc)
+{
+    const SCAN_TIMING_T* timing = &scan_timing[bpc];
+    pio_sm_set_clkdiv_int_frac(scan_pio, scan_sm_ctrl, timing->ctrl_div_int, timing->ctrl_div_frac);
+    pio_sm_set_clkdiv_int_frac(scan_pio, scan_sm_data, timing->data_div_int, timing->data_div_frac);
+    scan_bpc = bpc;
+}
+
+uint8_t scan_select_bpc(uint8_t bpc)
+{
+    if (bpc == 0) return scan_auto_bpc;
+    if (bpc < LED_MIN_BPC) return LED_MIN_BPC;
+    if (bpc > LED_MAX_BPC) return LED_MAX_BPC;
+    return bpc;
+}
+
+uint32_t scan_refresh_dhz(uint8_t bpc)
+{
+    return scan_timing[scan_select_bpc(bpc)].refresh_dhz;
+}
+
+static inline void scan_start(SCAN_FRAME_T* frame)
+{
+    dma_channel_set_read_addr(scan_dma_ctrl, frame->ctrl, false);
+    dma_channel_set_read_addr(scan_dma_sched, frame->sched, true);
+}
+
+// Runs on core1, and kept in ram so flash accesses from core0 don't delay the next frame
+static void __not_in_flash_func(scan_dma_handler)()
+{
+    // Only the null trigger at the end of a frame raises this
+    dma_hw->ints0 = 1u << scan_dma_data;
+
+    uint32_t status = spin_lock_blocking(scan_lock);
+    if (scan_ready >= 0) {
+        scan_front = scan_ready;
+        scan_ready = -1;
+    }
+    spin_unlock(scan_lock, status);
+    // The null trigger comes once the last slot is queued, while the ctrl machine may still be
+    // counting its delays. Let it finish them on the old clock, so the clocks only change once
+    // both machines wait for data. Only a change of bit depth waits, for at most that one slot.
+    if (scan_frame[scan_front].bpc != scan_bpc) {
+        hub75_wait_tx_stall(scan_pio, scan_sm_ctrl);
+        scan_set_timing(scan_frame[scan_front].bpc);
+    }
+    scan_start(&scan_frame[scan_front]);
+    scan_frames++;
+}
+
+uint32_t scan_frame_count()
+{
+    return scan_frames;
+}
+
+SCAN_FRAME_T* scan_get_frame()
+{
+    int8_t i;
+    uint32_t status = spin_lock_blocking(scan_lock);
+    // Called after the frame boundary that took up the last frame presented, so one is free
+    for (i = 0; i < SCAN_NUM_FRAMES; i++) {
+        if (i != scan_front && i != scan_ready) break;
+    }
+    spin_unlock(scan_lock, status);
+    return &scan_frame[i];
+}
+
+bool scan_present(SCAN_FRAME_T* frame)
+{
+    bool presented = false;
+    uint32_t status = spin_lock_blocking(scan_lock);
+    // Only one frame can wait for the scanout, so each composed frame gets displayed
+    if (scan_ready < 0) {
+        scan_ready = frame - scan_frame;
+        presented = true;
+    }
+    spin_unlock(scan_lock, status);
+    return presented;
+}
+
+// core1 owns the pio and dma, and only wakes up at the end of each frame
+static void scan_core1_main()
+{
+    dma_channel_config c;
+
+    // Let core0 park us while it writes to flash
+    multicore_lockout_victim_init();
+
+    // Choose PIO instance (0 or 1)
+    scan_pio = pio0;
+
+    // Get first 2 free state machine in PIO 0
+    scan_sm_ctrl = pio_claim_unused_sm(scan_pio, true);
+    scan_sm_data = pio_claim_unused_sm(scan_pio, true);
+
+    // Add PIO program to PIO instruction memory. SDK will find location and
+    // return with the memory offset of the program.
+    uint ctrl_offset = pio_add_program(scan_pio, &hub75_ctrl_program);
+    uint data_offset = pio_add_program(scan_pio, &hub75_data_program);
+
+    // Initialize the program using the helper function in our .pio file
+    // then set the PIO clock dividers for the depth of the first frame
+    hub75_data_program_init(scan_pio, scan_sm_data, data_offset, 1.0f);
+    hub75_ctrl_program_init(scan_pio, scan_sm_ctrl, ctrl_offset, 1.0f);
+    scan_set_timing(scan_frame[scan_front].bpc);
+
+    // Start running our PIO program in the state machine
+    pio_sm_set_enabled(scan_pio, scan_sm_data, true);
+    pio_sm_set_enabled(scan_pio, scan_sm_ctrl, true);
+
+    scan_dma_sched = dma_claim_unused_channel(true);
+    scan_dma_data = dma_claim_unused_channel(true);
+    scan_dma_ctrl = dma_claim_unused_channel(true);
+
+    c = dma_channel_get_default_config(scan_dma_data);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, pio_get_dreq(scan_pio, scan_sm_data, true));
+    channel_config_set_chain_to(&c, scan_dma_ctrl);
+    channel_config_set_irq_quiet(&c, true);
+    dma_channel_configure(scan_dma_data, &c, &scan_pio->txf[scan_sm_data], NULL, SCAN_DATA_WORDS, false);
+
+    c = dma_channel_get_default_config(scan_dma_ctrl);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, pio_get_dreq(scan_pio, scan_sm_ctrl, true));
+    channel_config_set_chain_to(&c, scan_dma_sched);
+    dma_channel_configure(scan_dma_ctrl, &c, &scan_pio->txf[scan_sm_ctrl], NULL, SCAN_CTRL_WORDS, false);
+
+    c = dma_channel_get_default_config(scan_dma_sched);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    dma_channel_configure(scan_dma_sched, &c, &dma_hw->ch[scan_dma_data].al3_read_addr_trig, NULL, 1, false);
+
+    dma_channel_set_irq0_enabled(scan_dma_data, true);
+    irq_set_exclusive_handler(DMA_IRQ_0, scan_dma_handler);
+    irq_set_enabled(DMA_IRQ_0, true);
+
+    scan_start(&scan_frame[scan_front]);
+
+    while (true) {
+        __wfi();
+    }
+}
+
+void scan_init()
+{
+    int i;
+
+    scan_lock = spin_lock_init(spin_lock_claim_unused(true));
+
+    for (i = LED_MIN_BPC; i <= LED_MAX_BPC; i++) {
+        scan_init_timing(i);
+    }
+
+    // All frames start out black, with a valid schedule
+    for (i = 0; i < SCAN_NUM_FRAMES; i++) {
+        scan_frame[i].bpc = scan_auto_bpc;
+        scan_build_sched(&scan_frame[i], 0, SCAN_MODE_BCM);
+        scan_frame[i].dirty_rows = SCAN_ALL_ROWS;
+    }
+
+    multicore_launch_core1(scan_core1_main);
+}
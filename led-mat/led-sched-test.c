@@ -0,0 +1,232 @@
+// Test of the scanout schedule on the host
+// Follows the dma channels of led-scan.c through the schedule scan_build_sched writes, the way
+// they chain on the device, and checks what reaches the two state machine fifos against what the
+// cpu loop that fed them before the dma scanout sent: for each row, lsb first, a bitplane to the
+// data machine then the row address and the delays of the bit to the ctrl machine. Split mode has
+// no such loop, so its slots are checked to add up to the same light for each plane of each row.
+// Every frame has to end in the null trigger that raises the frame interrupt.
+// usage: led-sched-test
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "led-render.h"
+
+#define TEST_SLOT_WORDS (SCAN_DATA_WORDS + SCAN_CTRL_WORDS)
+#define TEST_MAX_WORDS ((SCAN_SLOTS + 1) * TEST_SLOT_WORDS)
+
+enum TEST_FIFO_T {
+    TEST_FIFO_DATA,
+    TEST_FIFO_CTRL
+};
+
+// A word written to one of the state machine fifos
+typedef struct TEST_WORD_T_ {
+    enum TEST_FIFO_T fifo;
+    uint32_t value;
+} TEST_WORD_T;
+
+typedef struct TEST_TRACE_T_ {
+    TEST_WORD_T word[TEST_MAX_WORDS];
+    uint32_t num_words;
+    uint32_t slots;
+    bool irq;  // the frame ended with the null trigger
+} TEST_TRACE_T;
+
+static SCAN_FRAME_T test_frame;
+static TEST_TRACE_T test_dma_trace;
+static TEST_TRACE_T test_cpu_trace;
+static uint32_t test_failures = 0;
+
+// Each word of the encoded frame names its row, plane and column, so misplaced blocks show up
+static uint32_t test_data_word(uint32_t row, uint32_t plane, uint32_t i)
+{
+    return (row << 24) | (plane << 16) | i;
+}
+
+static void test_push(TEST_TRACE_T* trace, enum TEST_FIFO_T fifo, uint32_t value)
+{
+    trace->word[trace->num_words].fifo = fifo;
+    trace->word[trace->num_words].value = value;
+    trace->num_words++;
+}
+
+// The channels as led-scan.c sets them up: sched writes the next block address to the trigger of
+// data, data sends the block to the data fifo and chains to ctrl, ctrl sends the next words of
+// the ctrl list, carrying on from where the last slot left it, and chains back to sched.
+// A null trigger doesn't start data, and with IRQ_QUIET set it raises the frame interrupt instead.
+static bool test_run_dma(const SCAN_FRAME_T* frame, TEST_TRACE_T* trace)
+{
+    const uint32_t* const* sched = frame->sched;
+    const uint32_t* ctrl = frame->ctrl[0];
+    const uint32_t* data;
+    uint32_t offset, i;
+
+    trace->num_words = 0;
+    trace->slots = 0;
+    trace->irq = false;
+    while (sched < frame->sched + SCAN_SLOTS + 1) {
+        data = *sched++;
+        if (!data) {
+            trace->irq = true;
+            return true;
+        }
+        // blocks have to be whole bitplanes of the frame, or data would stream out something else
+        offset = data - frame->data[0][0];
+        if (data < frame->data[0][0] || offset % SCAN_DATA_WORDS != 0 ||
+            offset >= LED_SUBPANEL_HEIGHT * LED_MAX_BPC * SCAN_DATA_WORDS) {
+            printf("  slot %lu: data block outside the frame\n", (unsigned long)trace->slots);
+            return false;
+        }
+        for (i = 0; i < SCAN_DATA_WORDS; i++) {
+            test_push(trace, TEST_FIFO_DATA, data[i]);
+        }
+        for (i = 0; i < SCAN_CTRL_WORDS; i++) {
+            test_push(trace, TEST_FIFO_CTRL, *ctrl++);
+        }
+        trace->slots++;
+    }
+    printf("  no null trigger after %lu slots\n", (unsigned long)trace->slots);
+    return false;
+}
+
+// The loop that fed the state machines from the cpu before the dma scanout
+static void test_run_cpu(const SCAN_FRAME_T* frame, uint8_t brightness, TEST_TRACE_T* trace)
+{
+    uint32_t row, bit, i;
+    uint32_t set_mask;
+    uint32_t pio_delays;
+
+    trace->num_words = 0;
+    trace->slots = 0;
+    trace->irq = true;
+    for (row = 0; row < LED_SUBPANEL_HEIGHT; row++) {
+        set_mask = row_set_mask(row);
+        pio_delays = brightness;
+        pio_delays = ((MAX_BRIGHTNESS - pio_delays) << 16) | pio_delays;
+        for (bit = 0; bit < frame->bpc; bit++) {
+            for (i = 0; i < SCAN_DATA_WORDS; i++) {
+                test_push(trace, TEST_FIFO_DATA, frame->data[row][bit][i]);
+            }
+            test_push(trace, TEST_FIFO_CTRL, set_mask);
+            test_push(trace, TEST_FIFO_CTRL, pio_delays << bit);
+            trace->slots++;
+        }
+    }
+}
+
+static void test_fail(uint8_t bpc, uint8_t mode, uint8_t brightness, const char* what, uint32_t slot)
+{
+    printf("depth %u %-5s brightness %3u: %s, slot %lu\n", bpc, (mode == SCAN_MODE_SPLIT) ? "split" : "bcm",
+        brightness, what, (unsigned long)slot);
+    test_failures++;
+}
+
+static void test_bcm(uint8_t bpc, uint8_t brightness)
+{
+    const TEST_WORD_T* got;
+    const TEST_WORD_T* want;
+    uint32_t w, slot;
+
+    test_run_cpu(&test_frame, brightness, &test_cpu_trace);
+    if (test_dma_trace.slots != test_cpu_trace.slots) {
+        test_fail(bpc, SCAN_MODE_BCM, brightness, "slot count differs", test_dma_trace.slots);
+        return;
+    }
+    for (w = 0; w < test_cpu_trace.num_words; w++) {
+        got = &test_dma_trace.word[w];
+        want = &test_cpu_trace.word[w];
+        if (got->fifo == want->fifo && got->value == want->value) continue;
+        slot = w / TEST_SLOT_WORDS;
+        if (got->fifo != want->fifo) {
+            test_fail(bpc, SCAN_MODE_BCM, brightness, "words go to the wrong state machine", slot);
+        } else if (got->fifo == TEST_FIFO_DATA) {
+            test_fail(bpc, SCAN_MODE_BCM, brightness, "bitplane out of order", slot);
+        } else if (w % TEST_SLOT_WORDS == SCAN_DATA_WORDS) {
+            test_fail(bpc, SCAN_MODE_BCM, brightness, "row address out of order", slot);
+        } else {
+            test_fail(bpc, SCAN_MODE_BCM, brightness, "delays differ", slot);
+        }
+        return;
+    }
+}
+
+// Each pass of split mode goes through the rows in order, and the slots of a plane of a row add up
+// to the delays the plane has in bcm mode
+static void test_split(uint8_t bpc, uint8_t brightness)
+{
+    uint32_t pio_delays = ((MAX_BRIGHTNESS - brightness) << 16) | brightness;
+    uint32_t total[LED_SUBPANEL_HEIGHT][LED_MAX_BPC] = { { 0 } };
+    const TEST_WORD_T* word;
+    uint32_t slot, row, plane;
+
+    if (test_dma_trace.slots % LED_SUBPANEL_HEIGHT != 0) {
+        test_fail(bpc, SCAN_MODE_SPLIT, brightness, "rows get different slot counts", test_dma_trace.slots);
+        return;
+    }
+    for (slot = 0; slot < test_dma_trace.slots; slot++) {
+        word = &test_dma_trace.word[slot * TEST_SLOT_WORDS];
+        row = word[0].value >> 24;
+        plane = (word[0].value >> 16) & 0xff;
+        if (row != slot % LED_SUBPANEL_HEIGHT) {
+            test_fail(bpc, SCAN_MODE_SPLIT, brightness, "bitplane of the wrong row", slot);
+            return;
+        }
+        if (plane >= bpc) {
+            test_fail(bpc, SCAN_MODE_SPLIT, brightness, "bitplane beyond the bit depth", slot);
+            return;
+        }
+        if (word[SCAN_DATA_WORDS].value != row_set_mask(row)) {
+            test_fail(bpc, SCAN_MODE_SPLIT, brightness, "row address out of order", slot);
+            return;
+        }
+        total[row][plane] += word[SCAN_DATA_WORDS + 1].value;
+    }
+    for (row = 0; row < LED_SUBPANEL_HEIGHT; row++) {
+        for (plane = 0; plane < bpc; plane++) {
+            if (total[row][plane] != pio_delays << plane) {
+                test_fail(bpc, SCAN_MODE_SPLIT, brightness, "delays of a plane don't add up", row);
+                return;
+            }
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const uint8_t brightness[] = { 0, 1, 8, 100, MAX_BRIGHTNESS - 1 };
+    uint32_t row, plane, i, b;
+    uint8_t bpc, mode;
+    uint32_t runs = 0;
+
+    for (row = 0; row < LED_SUBPANEL_HEIGHT; row++) {
+        for (plane = 0; plane < LED_MAX_BPC; plane++) {
+            for (i = 0; i < SCAN_DATA_WORDS; i++) {
+                test_frame.data[row][plane][i] = test_data_word(row, plane, i);
+            }
+        }
+    }
+
+    for (bpc = LED_MIN_BPC; bpc <= LED_MAX_BPC; bpc++) {
+        for (mode = SCAN_MODE_BCM; mode <= SCAN_MODE_SPLIT; mode++) {
+            for (b = 0; b < sizeof(brightness); b++) {
+                // a schedule left from a deeper frame must not leak into this one
+                test_frame.bpc = LED_MAX_BPC;
+                scan_build_sched(&test_frame, MAX_BRIGHTNESS - 1, SCAN_MODE_SPLIT);
+                test_frame.bpc = bpc;
+                scan_build_sched(&test_frame, brightness[b], mode);
+                runs++;
+                if (!test_run_dma(&test_frame, &test_dma_trace) || !test_dma_trace.irq) {
+                    test_fail(bpc, mode, brightness[b], "frame doesn't end in the null trigger", test_dma_trace.slots);
+                    continue;
+                }
+                if (mode == SCAN_MODE_SPLIT) {
+                    test_split(bpc, brightness[b]);
+                } else {
+                    test_bcm(bpc, brightness[b]);
+                }
+            }
+        }
+    }
+    printf("%lu schedules, %lu failed\n", (unsigned long)runs, (unsigned long)test_failures);
+    return test_failures ? 1 : 0;
+}
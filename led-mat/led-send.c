@@ -0,0 +1,114 @@
+// Streams raw frames to the panel over UDP, for live video
+// Reads raw RGB565 frames the size of the panel, little endian and back to back, and sends them
+// over and over at the given frame rate; ffmpeg can make them from any video:
+//   ffmpeg -i video.mp4 -vf scale=128:32 -f rawvideo -pix_fmt rgb565le frames.raw
+// usage: led-send host input [fps] [port]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <netdb.h>
+#include <sys/socket.h>
+#include "led-stream.h"
+
+#define FRAME_PIXELS (LED_PANEL_WIDTH * LED_PANEL_HEIGHT)
+
+static uint64_t send_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+int main(int argc, char** argv)
+{
+    FILE* file;
+    long size;
+    uint32_t num_frames, f, row, rows;
+    uint16_t* frames;
+    uint16_t frame_id = 0;
+    uint8_t datagram[STREAM_HEADER_SIZE + STREAM_MAX_ROWS * LED_PANEL_WIDTH * 2];
+    uint32_t len;
+    double fps = (argc > 3) ? strtod(argv[3], NULL) : 30.0;
+    const char* port = (argc > 4) ? argv[4] : NULL;
+    char port_str[8];
+    struct addrinfo hints, *addr;
+    struct timespec ts;
+    uint64_t next_ns, report_ns;
+    uint32_t sent = 0;
+    uint32_t failed = 0;
+    int sock;
+
+    if (argc < 3 || fps <= 0) {
+        printf("usage: %s host input [fps] [port]\n", argv[0]);
+        return 1;
+    }
+
+    file = fopen(argv[2], "rb");
+    if (!file) {
+        printf("can't open %s\n", argv[2]);
+        return 1;
+    }
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    num_frames = size / (2 * FRAME_PIXELS);
+    if (num_frames == 0) {
+        printf("%s holds less than a %dx%d frame\n", argv[2], LED_PANEL_WIDTH, LED_PANEL_HEIGHT);
+        fclose(file);
+        return 1;
+    }
+    frames = malloc((size_t)num_frames * FRAME_PIXELS * 2);
+    if (fread(frames, 2 * FRAME_PIXELS, num_frames, file) != num_frames) {
+        printf("can't read %s\n", argv[2]);
+        fclose(file);
+        return 1;
+    }
+    fclose(file);
+
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_DGRAM;
+    if (!port) {
+        sprintf(port_str, "%d", STREAM_PORT);
+        port = port_str;
+    }
+    if (getaddrinfo(argv[1], port, &hints, &addr) != 0) {
+        printf("can't find %s\n", argv[1]);
+        return 1;
+    }
+    sock = socket(addr->ai_family, addr->ai_socktype, addr->ai_protocol);
+    if (sock < 0 || connect(sock, addr->ai_addr, addr->ai_addrlen) != 0) {
+        printf("can't reach %s\n", argv[1]);
+        return 1;
+    }
+    freeaddrinfo(addr);
+
+    printf("sending %lu frames at %.1f fps\n", (unsigned long)num_frames, fps);
+    next_ns = send_ns();
+    report_ns = next_ns + 1000000000ull;
+    for (f = 0; ; f = (f + 1) % num_frames) {
+        for (row = 0; row < LED_PANEL_HEIGHT; row += rows) {
+            rows = (LED_PANEL_HEIGHT - row < STREAM_MAX_ROWS) ? LED_PANEL_HEIGHT - row : STREAM_MAX_ROWS;
+            len = stream_encode(datagram, frame_id, row, rows, frames + (size_t)f * FRAME_PIXELS + row * LED_PANEL_WIDTH);
+            // nothing listening yet is not fatal, the panel may be restarting
+            if (send(sock, datagram, len, 0) != len) failed++;
+        }
+        frame_id++;
+        sent++;
+
+        next_ns += (uint64_t)(1000000000.0 / fps);
+        ts.tv_sec = next_ns / 1000000000ull;
+        ts.tv_nsec = next_ns % 1000000000ull;
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL);
+        if (send_ns() >= report_ns) {
+            printf("%lu fps, %lu datagrams not sent\n", (unsigned long)sent, (unsigned long)failed);
+            sent = 0;
+            failed = 0;
+            fflush(stdout);
+            report_ns += 1000000000ull;
+        }
+    }
+    return 0;
+}
@@ -7,6 +7,7 @@
 #define POLL_TIME_S 5
 
 extern uint32_t image_data[DEF_FRAMEBUFFER_SIZE / 4];
+extern RENDER_STATS_T render_stats;
 
 int tcp_server_init(TCP_SERVER_T* state)
 {
@@ -37,21 +38,55 @@ void tcp_server_deinit()
     cyw43_arch_deinit();
 }
 
+static void tcp_server_copy_part(ANIM_SAVE_STATE_T* dst, const ANIM_SAVE_STATE_T* src, uint8_t part)
+{
+    if (part == SCENE_PART_GLOBAL) {
+        memcpy(dst, src, offsetof(ANIM_SAVE_STATE_T, layer));
+    } else if (part < SCENE_PART_SPRITE(0)) {
+        dst->layer[part - SCENE_PART_LAYER(0)] = src->layer[part - SCENE_PART_LAYER(0)];
+    } else {
+        dst->sprite[part - SCENE_PART_SPRITE(0)] = src->sprite[part - SCENE_PART_SPRITE(0)];
+    }
+}
+
+// Gives up the edits to parts of the scene, the edit copy goes back to the parts as shown
+static void tcp_server_revert(TCP_SERVER_T* state, uint32_t parts)
+{
+    uint8_t part, c;
+
+    for (part = 0; part < SCENE_NUM_PARTS; part++) {
+        if (parts & (1u << part)) tcp_server_copy_part(&state->edit, &state->anim, part);
+    }
+    for (c = 0; c < MAX_CLIENTS; c++) {
+        state->client[c].dirty &= ~parts;
+    }
+}
+
+// A client gone in the middle of a command leaves the parts it edited half written, so they are
+// given up, along with what other clients edited in them. Otherwise they are applied at the next frame.
+static void tcp_server_drop(TCP_CLIENT_T* state)
+{
+    if (state->cmd != CMD_NONE && state->dirty) tcp_server_revert(state->server, state->dirty);
+    state->cmd = CMD_NONE;
+}
+
+// Frees the client's slot
 static err_t tcp_server_close(void* arg) {
-    TCP_SERVER_T* state = (TCP_SERVER_T*)arg;
+    TCP_CLIENT_T* state = (TCP_CLIENT_T*)arg;
     err_t err = ERR_OK;
-    if (state->client_pcb != NULL) {
-        tcp_arg(state->client_pcb, NULL);
-        tcp_poll(state->client_pcb, NULL, 0);
-        tcp_sent(state->client_pcb, NULL);
-        tcp_recv(state->client_pcb, NULL);
-        tcp_err(state->client_pcb, NULL);
-        err = tcp_close(state->client_pcb);
+    tcp_server_drop(state);
+    if (state->pcb != NULL) {
+        tcp_arg(state->pcb, NULL);
+        tcp_poll(state->pcb, NULL, 0);
+        tcp_sent(state->pcb, NULL);
+        tcp_recv(state->pcb, NULL);
+        tcp_err(state->pcb, NULL);
+        err = tcp_close(state->pcb);
         if (err != ERR_OK) {
-            tcp_abort(state->client_pcb);
+            tcp_abort(state->pcb);
             err = ERR_ABRT;
         }
-        state->client_pcb = NULL;
+        state->pcb = NULL;
     }
     //if (state->server_pcb) {
     //    tcp_arg(state->server_pcb, NULL);
@@ -67,12 +102,12 @@ static err_t tcp_server_sent(void* arg, struct tcp_pcb* tpcb, u16_t len) {
 
 err_t tcp_server_send_data(void* arg, struct tcp_pcb* tpcb, const char* data)
 {
-    TCP_SERVER_T* state = (TCP_SERVER_T*)arg;
-
     // this method is callback from lwIP, so cyw43_arch_lwip_begin is not required, however you
     // can use this method to cause an assertion in debug mode, if this method is called when
     // cyw43_arch_lwip_begin IS needed
     cyw43_arch_lwip_check();
+    // a reply that failed before closed the connection
+    if (!tpcb) return ERR_ABRT;
     err_t err = tcp_write(tpcb, data, strlen(data), TCP_WRITE_FLAG_COPY);
     if (err != ERR_OK) {
         return tcp_server_close(arg);
@@ -80,12 +115,207 @@ err_t tcp_server_send_data(void* arg, struct tcp_pcb* tpcb, const char* data)
     return ERR_OK;
 }
 
-void tcp_server_load_anim(TCP_SERVER_T* state, ANIM_SEQ_T* anim_seq)
+// A command is done, acked right away or, when pipelined, along with the rest of the poll
+static void tcp_server_ok(TCP_CLIENT_T* state)
+{
+    if (!state->pipelined) {
+        tcp_server_send_data(state, state->pcb, "[OK]\r\n");
+        return;
+    }
+    state->ack_seq = state->seq++;
+    state->ack_pending = true;
+}
+
+static void tcp_server_fail(TCP_CLIENT_T* state, uint8_t code)
+{
+    char buf[16];
+
+    if (!state->pipelined) {
+        sprintf(buf, "[ERR %u]\r\n", code);
+        tcp_server_send_data(state, state->pcb, buf);
+        return;
+    }
+    if (state->num_errors < MAX_ACK_ERRORS) {
+        state->error[state->num_errors].seq = state->seq;
+        state->error[state->num_errors].code = code;
+        state->num_errors++;
+    } else {
+        state->more_errors++;
+    }
+    state->ack_seq = state->seq++;
+    state->ack_pending = true;
+}
+
+// Acks every pipelined command processed since the last poll in one line, the sequence number
+// of the last one and those of the ones that failed: [ACK 42 ERR 37:1 40:2]
+static void tcp_server_ack_client(TCP_CLIENT_T* state)
+{
+    char buf[32 + MAX_ACK_ERRORS * 16];
+    int len;
+    uint8_t e;
+
+    if (!state->ack_pending) return;
+    state->ack_pending = false;
+    if (!state->pcb) return;
+    len = sprintf(buf, "[ACK %u", state->ack_seq);
+    for (e = 0; e < state->num_errors; e++) {
+        len += sprintf(buf + len, " ERR %u:%u", state->error[e].seq, state->error[e].code);
+    }
+    if (state->more_errors) {
+        len += sprintf(buf + len, " +%u", state->more_errors);
+    }
+    sprintf(buf + len, "]\r\n");
+    state->num_errors = 0;
+    state->more_errors = 0;
+
+    cyw43_arch_lwip_begin();
+    if (tcp_server_send_data(state, state->pcb, buf) == ERR_OK && state->pcb) {
+        tcp_output(state->pcb);
+    }
+    cyw43_arch_lwip_end();
+}
+
+void tcp_server_ack(TCP_SERVER_T* state)
+{
+    uint8_t c;
+    for (c = 0; c < MAX_CLIENTS; c++) {
+        tcp_server_ack_client(&state->client[c]);
+    }
+}
+
+// Pipelines the commands that follow, numbering them from the one given
+static void tcp_server_set_seq(TCP_CLIENT_T* state)
+{
+    state->seq = state->cur_value;
+    state->pipelined = true;
+    state->cmd = CMD_NONE;
+    state->arg_len = 0;
+}
+
+// Uploads have to fit in image data, the length is in bytes
+static bool tcp_server_data_fits(TCP_CLIENT_T* state, uint32_t len)
+{
+    uint32_t offset;
+
+    if (!state->img_data) return false;
+    offset = (uint8_t*)state->img_data - (uint8_t*)image_data;
+    return len <= DEF_FRAMEBUFFER_SIZE - offset;
+}
+
+// Report the bit depth the requested one resolves to, and the refresh rate it runs at
+static void tcp_server_send_depth(TCP_CLIENT_T* state, uint8_t bpc)
+{
+    char buf[48];
+    uint32_t refresh = scan_refresh_dhz(bpc);
+    sprintf(buf, "depth %u refresh %lu.%lu Hz\r\n",
+        scan_select_bpc(bpc), (unsigned long)(refresh / 10), (unsigned long)(refresh % 10));
+    tcp_server_send_data(state, state->pcb, buf);
+}
+
+// Report the compositor counters
+static void tcp_server_send_info(TCP_CLIENT_T* state)
+{
+    char buf[96];
+    sprintf(buf, "frames %lu rows %lu last %lu text %lu direct %lu\r\n",
+        (unsigned long)render_stats.frames, (unsigned long)render_stats.rows, (unsigned long)render_stats.last_rows,
+        (unsigned long)render_stats.text_cached, (unsigned long)render_stats.text_direct);
+    tcp_server_send_data(state, state->pcb, buf);
+    sprintf(buf, "stream %lu shown %lu dropped %lu replaced %lu\r\n",
+        (unsigned long)state->server->stream.stats.frames, (unsigned long)state->server->stream.stats.shown,
+        (unsigned long)state->server->stream.stats.dropped, (unsigned long)state->server->stream.stats.replaced);
+    tcp_server_send_data(state, state->pcb, buf);
+    sprintf(buf, "dmx %lu frames %lu synced %lu partial %lu errors %lu\r\n",
+        (unsigned long)state->server->dmx.stats.packets, (unsigned long)state->server->dmx.stats.frames,
+        (unsigned long)state->server->dmx.stats.synced, (unsigned long)state->server->dmx.stats.partial,
+        (unsigned long)state->server->dmx.stats.errors);
+    tcp_server_send_data(state, state->pcb, buf);
+    tcp_server_send_depth(state, state->server->anim.bpc);
+}
+
+// Font of the current layer, FONT_ID_IMAGE to show RGB565 pixels instead of text
+static void tcp_server_set_font(TCP_CLIENT_T* state)
+{
+    if (state->cur_value == FONT_ID_IMAGE) {
+        state->anim->layer[state->cur_layer].box.font = NULL;
+        return;
+    }
+    if (state->cur_value >= MAX_FONT) state->cur_value = 0;
+    state->anim->layer[state->cur_layer].box.font = font[state->cur_value];
+}
+
+// Bit depth, 0 for the deepest one that keeps the configured refresh rate
+static void tcp_server_set_depth(TCP_CLIENT_T* state)
+{
+    state->anim->bpc = (state->cur_value > LED_MAX_BPC) ? LED_MAX_BPC : state->cur_value;
+    if (state->anim->bpc != 0 && state->anim->bpc < LED_MIN_BPC) state->anim->bpc = LED_MIN_BPC;
+    // a pipelined client reads it from @I instead, its stream only carries the ACK lines
+    if (!state->pipelined) tcp_server_send_depth(state, state->anim->bpc);
+    tcp_server_ok(state);
+    state->cmd = CMD_NONE;
+    state->arg_len = 0;
+}
+
+// Pixel format of a backdrop animation, and the offset in image_data of the palette of the palette
+// formats or the tile atlas of the tilemap formats
+static void tcp_server_set_format(TCP_CLIENT_T* state, uint32_t format)
+{
+    if (format > IMG_FORMAT_TILES16 || format == IMG_FORMAT_ARGB4444) format = IMG_FORMAT_RGB565;
+    state->anim->back_anim.anim[state->arg_index].format = format;
+}
+
+static void tcp_server_set_table(TCP_CLIENT_T* state)
+{
+    ANIM_T* anim = &(state->anim->back_anim.anim[state->arg_index]);
+    const uint16_t* table = (const uint16_t*)((uint8_t*)image_data + (state->cur_value & ~1));
+    bool tiles = anim->format == IMG_FORMAT_TILES8 || anim->format == IMG_FORMAT_TILES16;
+    anim->palette = tiles ? NULL : table;
+    anim->tiles = tiles ? table : NULL;
+    // the playing animation, or a still backdrop, changes right away
+    if (state->arg_index == state->anim->back_anim.cur_anim) {
+        state->anim->backdrop.format = anim->format;
+        state->anim->backdrop.palette = anim->palette;
+        state->anim->backdrop.tiles = anim->tiles;
+    }
+    tcp_server_ok(state);
+    state->cmd = CMD_NONE;
+    state->arg_len = 0;
+}
+
+// E1.31 universes are sent to a multicast group each, 239.255.hi.lo
+static void tcp_server_sacn_group(uint16_t universe, bool join)
+{
+    ip4_addr_t group;
+    IP4_ADDR(&group, 239, 255, universe >> 8, universe & 0xff);
+    if (join) {
+        igmp_joingroup(IP4_ADDR_ANY4, &group);
+    } else {
+        igmp_leavegroup(IP4_ADDR_ANY4, &group);
+    }
+}
+
+// Universes mapped onto the panel, with the multicast groups following them
+static void tcp_server_set_dmx(TCP_SERVER_T* state, uint16_t first_universe, uint8_t universe_pixels, uint8_t flags)
+{
+    uint32_t u;
+
+    for (u = 0; u < state->dmx.num_universes; u++) {
+        tcp_server_sacn_group(state->dmx.first_universe + u, false);
+    }
+    dmx_config(&state->dmx, first_universe, universe_pixels, flags);
+    for (u = 0; u < state->dmx.num_universes; u++) {
+        tcp_server_sacn_group(state->dmx.first_universe + u, true);
+    }
+}
+
+void tcp_server_load_anim(TCP_CLIENT_T* state, ANIM_SEQ_T* anim_seq)
 {
     ANIM_T* anim = &(anim_seq->anim[anim_seq->cur_anim]);
     switch (state->arg_len) {
     case 28:
         anim->src_data.start_value = (uint8_t*)image_data + state->cur_value;
+        anim->format = IMG_FORMAT_RGB565;
+        anim->palette = NULL;
+        anim->tiles = NULL;
         state->cur_value = 0;
         break;
     case 26:
@@ -148,7 +378,7 @@ void tcp_server_load_anim(TCP_SERVER_T* state, ANIM_SEQ_T* anim_seq)
             anim_seq->cur_anim = 0;
             anim_seq->frame_count = 0;
             state->cmd = CMD_NONE;
-            tcp_server_send_data(state, state->client_pcb, "[OK]\r\n");
+            tcp_server_ok(state);
             state->arg_len = 0;
         } else {
             state->arg_len = 32;
@@ -157,18 +387,106 @@ void tcp_server_load_anim(TCP_SERVER_T* state, ANIM_SEQ_T* anim_seq)
     }
 }
 
-err_t tcp_server_recv(void* arg, struct tcp_pcb* tpcb, struct pbuf* p, err_t err) {
-    TCP_SERVER_T* state = (TCP_SERVER_T*)arg;
-    if (!p) {
-        return tcp_server_close(arg);
+// A binary upload takes the whole pixels at the start of a segment in one go, returns the bytes taken
+// One that doesn't fit in image data is passed over
+static uint16_t tcp_server_upload(TCP_CLIENT_T* state, const char* data, uint16_t len)
+{
+    uint32_t num_pixels = ((len < state->arg_len) ? len : state->arg_len) >> 1;
+
+    if (state->cmd == CMD_DATA_SKIP) {
+        if (len > state->arg_len) len = state->arg_len;
+        state->arg_len -= len;
+        if (state->arg_len == 0) {
+            tcp_server_fail(state, ACK_ERR_DATA_RANGE);
+            state->cmd = CMD_NONE;
+        }
+        return len;
     }
-    // this method is callback from lwIP, so cyw43_arch_lwip_begin is not required, however you
-    // can use this method to cause an assertion in debug mode, if this method is called when
-    // cyw43_arch_lwip_begin IS needed
-    cyw43_arch_lwip_check();
+    if (num_pixels == 0) return 0;
+    if (!state->data_start || state->img_data < state->data_start) state->data_start = state->img_data;
+    upload_pixels(state->img_data, (const uint8_t*)data, num_pixels);
+    state->img_data += num_pixels;
+    if (state->img_data > state->data_end) state->data_end = state->img_data;
+    state->arg_len -= 2 * num_pixels;
+    if (state->arg_len == 0) {
+        tcp_server_ok(state);
+        state->cmd = CMD_NONE;
+    }
+    return 2 * num_pixels;
+}
+
+// A command is about to edit a part of the scene, the edit copy picks up the part as shown
+// unless a client already has edits to it waiting for the frame boundary
+static void tcp_server_touch(TCP_CLIENT_T* state, uint8_t part)
+{
+    TCP_SERVER_T* server = state->server;
+    uint32_t bit = 1u << part;
+    uint8_t c;
+
+    if (state->dirty & bit) return;
+    for (c = 0; c < MAX_CLIENTS; c++) {
+        if (server->client[c].dirty & bit) break;
+    }
+    if (c == MAX_CLIENTS) tcp_server_copy_part(&server->edit, &server->anim, part);
+    state->dirty |= bit;
+}
+
+// Copies the parts of the scene edited by a client into the one shown
+static void tcp_server_apply(TCP_SERVER_T* state, uint32_t parts)
+{
+    uint8_t part, c;
+
+    for (part = 0; part < SCENE_NUM_PARTS; part++) {
+        if (parts & (1u << part)) tcp_server_copy_part(&state->anim, &state->edit, part);
+    }
+    for (c = 0; c < MAX_CLIENTS; c++) {
+        state->client[c].dirty &= ~parts;
+    }
+}
+
+// Parts of the scene clients other than except are in the middle of a command on
+static uint32_t tcp_server_busy(TCP_SERVER_T* state, const TCP_CLIENT_T* except)
+{
+    uint32_t busy = 0;
+    uint8_t c;
+
+    for (c = 0; c < MAX_CLIENTS; c++) {
+        if (&state->client[c] != except && state->client[c].cmd != CMD_NONE) busy |= state->client[c].dirty;
+    }
+    return busy;
+}
+
+// Called at the frame boundary, so the frame shows each part of the scene as it was before or
+// after a command and never halfway. Parts a client is in the middle of a command on wait for
+// the next frame, even when another client edited them too.
+// Returns the parts still being edited, whose animations have to stand still until they are
+// applied, or the edit copy would take them back to where they were when it was made.
+uint32_t tcp_server_commit(TCP_SERVER_T* state)
+{
+    uint32_t busy = tcp_server_busy(state, NULL);
+    uint32_t parts = 0;
+    uint8_t c;
+
+    for (c = 0; c < MAX_CLIENTS; c++) {
+        if (state->client[c].cmd == CMD_NONE) parts |= state->client[c].dirty;
+    }
+    parts &= ~busy;
+    if (parts) tcp_server_apply(state, parts);
+    return busy;
+}
+
+// Parses a segment of the command stream
+static void tcp_server_parse(void* arg, const char* data, uint16_t len)
+{
+    TCP_CLIENT_T* state = (TCP_CLIENT_T*)arg;
     uint16_t i;
-    const char* data = (const char*)p->payload;
-    for (i = 0; i < p->tot_len; i++) {
+    // a reply that can't be sent closes the connection, and the rest is given up
+    for (i = 0; i < len && state->pcb; i++) {
+        // Binary uploads skip the parser between pixels, a pixel split across segments goes through it
+        if (state->server->bulk_upload && !state->ascii_mode && ((state->cmd == CMD_DATA && (state->arg_len & 0x1) == 0) || state->cmd == CMD_DATA_SKIP)) {
+            i += tcp_server_upload(state, data + i, len - i);
+            if (i == len) break;
+        }
         switch (state->cmd) {
         case CMD_NONE:
             if (data[i] == '@') {
@@ -185,30 +503,110 @@ err_t tcp_server_recv(void* arg, struct tcp_pcb* tpcb, struct pbuf* p, err_t err
                 state->arg_len = 0;
                 break;
             case 'A':
+                tcp_server_touch(state, SCENE_PART_GLOBAL);
                 state->cmd = CMD_BACK_ANIM_HEADER;
                 state->arg_len = 1;
                 break;
+            case 'N':
+                tcp_server_touch(state, SCENE_PART_LAYER(state->cur_layer));
+                state->cmd = CMD_OVER_ANIM_HEADER;
+                state->arg_len = 1;
+                break;
+            case 'j':
+                tcp_server_touch(state, SCENE_PART_SPRITE(state->cur_sprite));
+                state->cmd = CMD_SPRITE_ANIM_HEADER;
+                state->arg_len = 1;
+                break;
+            case 'J':
+                state->cmd = CMD_SPRITE;
+                state->arg_len = 1;
+                break;
+            case 'Q':
+                tcp_server_touch(state, SCENE_PART_SPRITE(state->cur_sprite));
+                state->cmd = CMD_SPRITE_IMAGE;
+                state->arg_len = 8;
+                break;
+            case 'Z':
+                tcp_server_touch(state, SCENE_PART_SPRITE(state->cur_sprite));
+                state->cmd = CMD_SPRITE_POS;
+                state->arg_len = 4;
+                break;
+            case 'z':
+                tcp_server_touch(state, SCENE_PART_SPRITE(state->cur_sprite));
+                state->cmd = CMD_SPRITE_ATTR;
+                state->arg_len = 3;
+                break;
+            case 'L':
+                state->cmd = CMD_LAYER;
+                state->arg_len = 1;
+                break;
+            case 'H':
+                tcp_server_touch(state, SCENE_PART_LAYER(state->cur_layer));
+                state->cmd = CMD_LAYER_SIZE;
+                state->arg_len = 4;
+                break;
+            case 'C':
+                tcp_server_touch(state, SCENE_PART_LAYER(state->cur_layer));
+                state->cmd = CMD_LAYER_COLOR;
+                state->arg_len = 4;
+                break;
+            case 'X':
+                tcp_server_touch(state, SCENE_PART_LAYER(state->cur_layer));
+                state->cmd = CMD_LAYER_BLEND;
+                state->arg_len = 2;
+                break;
+            case 'Y':
+                tcp_server_touch(state, SCENE_PART_GLOBAL);
+                state->cmd = CMD_BACK_FORMAT;
+                state->arg_len = 6;
+                break;
             case 'B':
+                tcp_server_touch(state, SCENE_PART_GLOBAL);
                 state->cmd = CMD_BRIGHTNESS;
                 state->arg_len = 1;
                 break;
+            case 'P':
+                tcp_server_touch(state, SCENE_PART_GLOBAL);
+                state->cmd = CMD_BIT_DEPTH;
+                state->arg_len = 1;
+                break;
+            case 'G':
+                tcp_server_touch(state, SCENE_PART_GLOBAL);
+                state->cmd = CMD_GAMMA;
+                state->arg_len = 4;
+                break;
+            case 'M':
+                tcp_server_touch(state, SCENE_PART_GLOBAL);
+                state->cmd = CMD_SCAN_MODE;
+                state->arg_len = 1;
+                break;
+            case 'K':
+                tcp_server_touch(state, SCENE_PART_GLOBAL);
+                state->cmd = CMD_ANIM_TICK;
+                state->arg_len = 2;
+                break;
             case 'O':
+                tcp_server_touch(state, SCENE_PART_GLOBAL);
                 state->cmd = CMD_OFFSET;
                 state->arg_len = 4;
                 break;
             case 'V':
+                tcp_server_touch(state, SCENE_PART_LAYER(state->cur_layer));
                 state->cmd = CMD_OVERLAY_ENABLE;
                 state->arg_len = 1;
                 break;
             case 'F':
+                tcp_server_touch(state, SCENE_PART_LAYER(state->cur_layer));
                 state->cmd = CMD_FONT;
                 state->arg_len = 1;
                 break;
             case 'T':
+                tcp_server_touch(state, SCENE_PART_LAYER(state->cur_layer));
                 state->cmd = CMD_TEXT_OFFSET;
                 state->arg_len = 4;
                 break;
             case 'S':
+                tcp_server_touch(state, SCENE_PART_LAYER(state->cur_layer));
                 state->cmd = CMD_TEXT_SCROLL;
                 state->arg_len = 4;
                 break;
@@ -216,37 +614,60 @@ err_t tcp_server_recv(void* arg, struct tcp_pcb* tpcb, struct pbuf* p, err_t err
                 state->cmd = CMD_DATA_HEADER;
                 state->arg_len = 8;
                 break;
+            case 'x':
+                state->cmd = CMD_DMX;
+                state->arg_len = 4;
+                break;
+            case '#':
+                state->cmd = CMD_SEQUENCE;
+                state->arg_len = state->ascii_mode ? 1 : 2;
+                break;
             case 'a':
                 state->ascii_mode = true;
                 state->cmd = CMD_NONE;
-                tcp_server_send_data(arg, state->client_pcb, "[OK]\r\n");
+                tcp_server_ok(state);
                 break;
             case 'b':
                 state->ascii_mode = false;
                 state->cmd = CMD_NONE;
-                tcp_server_send_data(arg, state->client_pcb, "[OK]\r\n");
+                tcp_server_ok(state);
                 break;
             case 'W':
+                // saves the scene with this client's edits in it, but for parts another client
+                // is in the middle of a command on, which are only applied once it's done
+                tcp_server_apply(state->server, state->dirty & ~tcp_server_busy(state->server, state));
                 flash_save();
                 state->cmd = CMD_NONE;
-                tcp_server_send_data(arg, state->client_pcb, "[OK]\r\n");
+                tcp_server_ok(state);
                 break;
             case 'R':
+                // edits waiting for the frame boundary would undo the load, so they are given up,
+                // but for parts another client is in the middle of a command on, which are only
+                // applied over the loaded scene once it's done
                 flash_load();
+                tcp_server_revert(state->server, ~tcp_server_busy(state->server, state));
                 state->cmd = CMD_NONE;
-                tcp_server_send_data(arg, state->client_pcb, "[OK]\r\n");
+                tcp_server_ok(state);
                 break;
             case 'E':
                 flash_set_valid(false);
                 state->cmd = CMD_NONE;
-                tcp_server_send_data(arg, state->client_pcb, "[OK]\r\n");
+                tcp_server_ok(state);
                 break;
             case 'U':
                 flash_set_valid(true);
                 state->cmd = CMD_NONE;
-                tcp_server_send_data(arg, state->client_pcb, "[OK]\r\n");
+                tcp_server_ok(state);
+                break;
+            case 'I':
+                tcp_server_send_info(state);
+                state->cmd = CMD_NONE;
+                tcp_server_ok(state);
                 break;
             default:
+                // lock-step clients never got a reply to an unknown command, only the sequenced
+                // stream has to account for it
+                if (state->pipelined) tcp_server_fail(state, ACK_ERR_UNKNOWN_CMD);
                 state->cmd = CMD_NONE;
                 break;
             }
@@ -281,77 +702,234 @@ err_t tcp_server_recv(void* arg, struct tcp_pcb* tpcb, struct pbuf* p, err_t err
                     switch (state->cmd) {
                     case CMD_BRIGHTNESS:
                         if (state->arg_len == 1) {
-                            state->anim.brightness = (state->cur_value >= MAX_BRIGHTNESS) ? MAX_BRIGHTNESS - 1 : state->cur_value;
-                            tcp_server_send_data(arg, state->client_pcb, "[OK]\r\n");
+                            state->anim->brightness = (state->cur_value >= MAX_BRIGHTNESS) ? MAX_BRIGHTNESS - 1 : state->cur_value;
+                            tcp_server_ok(state);
+                            state->cmd = CMD_NONE;
+                            state->arg_len = 0;
+                        }
+                        break;
+                    case CMD_BIT_DEPTH:
+                        if (state->arg_len == 1) {
+                            tcp_server_set_depth(state);
+                        }
+                        break;
+                    case CMD_LAYER:
+                        if (state->arg_len == 1) {
+                            state->cur_layer = (state->cur_value >= MAX_LAYERS) ? MAX_LAYERS - 1 : state->cur_value;
+                            tcp_server_ok(state);
+                            state->cmd = CMD_NONE;
+                            state->arg_len = 0;
+                        }
+                        break;
+                    case CMD_LAYER_SIZE:
+                        if (state->arg_len == 4) {
+                            state->anim->layer[state->cur_layer].box.width = state->cur_value;
+                            state->arg_len -= 2;
+                        } else if (state->arg_len == 2) {
+                            state->anim->layer[state->cur_layer].box.height = state->cur_value;
+                            tcp_server_ok(state);
+                            state->cmd = CMD_NONE;
+                            state->arg_len = 0;
+                        }
+                        break;
+                    case CMD_LAYER_COLOR:
+                        if (state->arg_len == 4) {
+                            state->anim->layer[state->cur_layer].box.fg_color = state->cur_value;
+                            state->arg_len -= 2;
+                        } else if (state->arg_len == 2) {
+                            state->anim->layer[state->cur_layer].box.bg_color = state->cur_value;
+                            tcp_server_ok(state);
+                            state->cmd = CMD_NONE;
+                            state->arg_len = 0;
+                        }
+                        break;
+                    case CMD_BACK_FORMAT:
+                        if (state->arg_len == 6) {
+                            state->arg_index = (state->cur_value >= MAX_ANIM) ? MAX_ANIM - 1 : state->cur_value;
+                            state->arg_len--;
+                        } else if (state->arg_len == 5) {
+                            tcp_server_set_format(state, state->cur_value);
+                            state->arg_len--;
+                        } else if (state->arg_len == 4) {
+                            tcp_server_set_table(state);
+                        }
+                        break;
+                    case CMD_LAYER_BLEND:
+                        if (state->arg_len == 2) {
+                            state->anim->layer[state->cur_layer].box.format = (state->cur_value == IMG_FORMAT_ARGB4444) ? IMG_FORMAT_ARGB4444 : IMG_FORMAT_RGB565;
+                            state->arg_len--;
+                        } else if (state->arg_len == 1) {
+                            state->anim->layer[state->cur_layer].box.opacity = (state->cur_value > MAX_OPACITY) ? MAX_OPACITY : state->cur_value;
+                            tcp_server_ok(state);
+                            state->cmd = CMD_NONE;
+                            state->arg_len = 0;
+                        }
+                        break;
+                    case CMD_SCAN_MODE:
+                        if (state->arg_len == 1) {
+                            state->anim->scan_mode = (state->cur_value == SCAN_MODE_SPLIT) ? SCAN_MODE_SPLIT : SCAN_MODE_BCM;
+                            tcp_server_ok(state);
+                            state->cmd = CMD_NONE;
+                            state->arg_len = 0;
+                        }
+                        break;
+                    case CMD_ANIM_TICK:
+                        if (state->arg_len == 2) {
+                            state->anim->anim_tick_ms = state->cur_value;
+                            tcp_server_ok(state);
+                            state->cmd = CMD_NONE;
+                            state->arg_len = 0;
+                        }
+                        break;
+                    case CMD_GAMMA:
+                        if (state->arg_len == 4) {
+                            state->anim->gamma = state->cur_value;
+                            state->arg_len -= 2;
+                        } else if (state->arg_len == 2) {
+                            state->anim->dither = (state->cur_value != 0) ? true : false;
+                            tcp_server_ok(state);
                             state->cmd = CMD_NONE;
                             state->arg_len = 0;
                         }
                         break;
                     case CMD_OVERLAY_ENABLE:
                         if (state->arg_len == 1) {
-                            state->anim.overlay_enable = (state->cur_value != 0) ? true : false;
-                            tcp_server_send_data(arg, state->client_pcb, "[OK]\r\n");
+                            state->anim->layer[state->cur_layer].enable = (state->cur_value != 0) ? true : false;
+                            tcp_server_ok(state);
+                            state->cmd = CMD_NONE;
+                            state->arg_len = 0;
+                        }
+                        break;
+                    case CMD_SPRITE:
+                        if (state->arg_len == 1) {
+                            state->cur_sprite = (state->cur_value >= MAX_SPRITES) ? MAX_SPRITES - 1 : state->cur_value;
+                            tcp_server_ok(state);
+                            state->cmd = CMD_NONE;
+                            state->arg_len = 0;
+                        }
+                        break;
+                    case CMD_SPRITE_IMAGE:
+                        if (state->arg_len == 8) {
+                            state->anim->sprite[state->cur_sprite].src_data = (const uint16_t*)((uint8_t*)image_data + (state->cur_value & ~1));
+                            state->arg_len -= 4;
+                        } else if (state->arg_len == 4) {
+                            state->anim->sprite[state->cur_sprite].width = state->cur_value;
+                            state->arg_len -= 2;
+                        } else if (state->arg_len == 2) {
+                            state->anim->sprite[state->cur_sprite].height = state->cur_value;
+                            state->anim->sprite[state->cur_sprite].enable = true;
+                            tcp_server_ok(state);
+                            state->cmd = CMD_NONE;
+                            state->arg_len = 0;
+                        }
+                        break;
+                    case CMD_SPRITE_POS:
+                        if (state->arg_len == 4) {
+                            state->anim->sprite[state->cur_sprite].x = state->cur_value;
+                            state->arg_len -= 2;
+                        } else if (state->arg_len == 2) {
+                            state->anim->sprite[state->cur_sprite].y = state->cur_value;
+                            tcp_server_ok(state);
+                            state->cmd = CMD_NONE;
+                            state->arg_len = 0;
+                        }
+                        break;
+                    case CMD_SPRITE_ATTR:
+                        if (state->arg_len == 3) {
+                            state->anim->sprite[state->cur_sprite].enable = state->cur_value != 0;
+                            state->arg_len--;
+                        } else if (state->arg_len == 2) {
+                            state->anim->sprite[state->cur_sprite].flags = state->cur_value & (SPRITE_FLIP_X | SPRITE_FLIP_Y);
+                            state->arg_len--;
+                        } else if (state->arg_len == 1) {
+                            state->anim->sprite[state->cur_sprite].priority = (state->cur_value > MAX_LAYERS) ? MAX_LAYERS : state->cur_value;
+                            tcp_server_ok(state);
+                            state->cmd = CMD_NONE;
+                            state->arg_len = 0;
+                        }
+                        break;
+                    case CMD_DMX:
+                        if (state->arg_len == 4) {
+                            state->dmx_first_universe = state->cur_value;
+                            state->arg_len -= 2;
+                        } else if (state->arg_len == 2) {
+                            state->dmx_universe_pixels = state->cur_value;
+                            state->arg_len--;
+                        } else if (state->arg_len == 1) {
+                            tcp_server_set_dmx(state->server, state->dmx_first_universe, state->dmx_universe_pixels, state->cur_value);
+                            tcp_server_ok(state);
                             state->cmd = CMD_NONE;
                             state->arg_len = 0;
                         }
                         break;
                     case CMD_OFFSET:
                         if (state->arg_len == 4) {
-                            state->anim.backdrop.y = state->cur_value;
+                            state->anim->backdrop.y = state->cur_value;
                             state->arg_len -= 2;
                         } else if (state->arg_len == 2) {
-                            state->anim.backdrop.x = state->cur_value;
-                            tcp_server_send_data(arg, state->client_pcb, "[OK]\r\n");
+                            state->anim->backdrop.x = state->cur_value;
+                            tcp_server_ok(state);
                             state->cmd = CMD_NONE;
                             state->arg_len = 0;
                         }
                         break;
                     case CMD_FONT:
                         if (state->arg_len == 1) {
-                            if (state->cur_value >= MAX_FONT) state->cur_value = 0;
-                            state->anim.overlay.font = font[state->cur_value];
-                            tcp_server_send_data(arg, state->client_pcb, "[OK]\r\n");
+                            tcp_server_set_font(state);
+                            tcp_server_ok(state);
                             state->cmd = CMD_NONE;
                             state->arg_len = 0;
                         }
                         break;
                     case CMD_TEXT_OFFSET:
                         if (state->arg_len == 4) {
-                            state->anim.overlay.x = state->cur_value;
+                            state->anim->layer[state->cur_layer].box.x = state->cur_value;
                             state->arg_len -= 2;
                         } else if (state->arg_len == 2) {
-                            state->anim.overlay.y = state->cur_value;
-                            tcp_server_send_data(arg, state->client_pcb, "[OK]\r\n");
+                            state->anim->layer[state->cur_layer].box.y = state->cur_value;
+                            tcp_server_ok(state);
                             state->cmd = CMD_NONE;
                             state->arg_len = 0;
                         }
                         break;
                     case CMD_TEXT_SCROLL:
                         if (state->arg_len == 4) {
-                            state->anim.overlay.offset_x = state->cur_value;
+                            state->anim->layer[state->cur_layer].box.offset_x = state->cur_value;
                             state->arg_len -= 2;
                         } else if (state->arg_len == 2) {
-                            state->anim.overlay.offset_y = state->cur_value;
-                            tcp_server_send_data(arg, state->client_pcb, "[OK]\r\n");
+                            state->anim->layer[state->cur_layer].box.offset_y = state->cur_value;
+                            tcp_server_ok(state);
                             state->cmd = CMD_NONE;
                             state->arg_len = 0;
                         }
                         break;
                     case CMD_DATA_HEADER:
                         if (state->arg_len == 8) {
-                            state->img_data = ((uint16_t*)image_data) + state->cur_value;
+                            state->img_data = (state->cur_value < DEF_FRAMEBUFFER_SIZE / 2) ? ((uint16_t*)image_data) + state->cur_value : NULL;
                             state->arg_len -= 4;
                         } else if (state->arg_len == 4) {
-                            state->cmd = CMD_DATA;
+                            state->cmd = tcp_server_data_fits(state, 2 * state->cur_value) ? CMD_DATA : CMD_DATA_SKIP;
                             state->arg_len = state->cur_value;
                         }
                         break;
+                    case CMD_DATA_SKIP:
+                        state->arg_len--;
+                        if (state->arg_len == 0) {
+                            tcp_server_fail(state, ACK_ERR_DATA_RANGE);
+                            state->cmd = CMD_NONE;
+                        }
+                        break;
+                    case CMD_SEQUENCE:
+                        tcp_server_set_seq(state);
+                        break;
                     case CMD_DATA:
+                        if (!state->data_start || state->img_data < state->data_start) state->data_start = state->img_data;
                         *state->img_data = state->cur_value;
                         state->img_data++;
+                        if (state->img_data > state->data_end) state->data_end = state->img_data;
                         state->arg_len--;
                         if (state->arg_len == 0) {
-                            tcp_server_send_data(arg, state->client_pcb, "[OK]\r\n");
+                            tcp_server_ok(state);
                             state->cmd = CMD_NONE;
                         }
                         break;
@@ -366,39 +944,235 @@ err_t tcp_server_recv(void* arg, struct tcp_pcb* tpcb, struct pbuf* p, err_t err
                     state->arg_len--;
                     switch (state->cmd) {
                     case CMD_BACK_ANIM_HEADER:
-                        state->anim.back_anim.num_anim = (state->cur_value >= MAX_ANIM) ? MAX_ANIM : state->cur_value;
+                        state->anim->back_anim.num_anim = (state->cur_value >= MAX_ANIM) ? MAX_ANIM : state->cur_value;
                         state->cmd = CMD_BACK_ANIM;
-                        state->anim.back_anim.cur_anim = 0;
+                        state->anim->back_anim.cur_anim = 0;
                         state->cur_value = 0;
                         state->arg_len = 32;
                         break;
                     case CMD_BACK_ANIM:
-                        tcp_server_load_anim(state, &(state->anim.back_anim));
+                        tcp_server_load_anim(state, &(state->anim->back_anim));
+                        break;
+                    case CMD_OVER_ANIM_HEADER:
+                        state->anim->layer[state->cur_layer].anim.num_anim = (state->cur_value >= MAX_ANIM) ? MAX_ANIM : state->cur_value;
+                        state->cmd = CMD_OVER_ANIM;
+                        state->anim->layer[state->cur_layer].anim.cur_anim = 0;
+                        state->cur_value = 0;
+                        state->arg_len = 32;
+                        break;
+                    case CMD_OVER_ANIM:
+                        tcp_server_load_anim(state, &(state->anim->layer[state->cur_layer].anim));
+                        break;
+                    case CMD_SPRITE_ANIM_HEADER:
+                        state->anim->sprite[state->cur_sprite].anim.num_anim = (state->cur_value >= MAX_ANIM) ? MAX_ANIM : state->cur_value;
+                        state->cmd = CMD_SPRITE_ANIM;
+                        state->anim->sprite[state->cur_sprite].anim.cur_anim = 0;
+                        state->anim->sprite[state->cur_sprite].anim.frame_count = 0;
+                        state->anim->sprite[state->cur_sprite].enable = true;
+                        state->cur_value = 0;
+                        state->arg_len = 32;
+                        break;
+                    case CMD_SPRITE_ANIM:
+                        tcp_server_load_anim(state, &(state->anim->sprite[state->cur_sprite].anim));
+                        break;
+                    case CMD_SPRITE:
+                        state->cur_sprite = (state->cur_value >= MAX_SPRITES) ? MAX_SPRITES - 1 : state->cur_value;
+                        tcp_server_ok(state);
+                        state->cmd = CMD_NONE;
+                        state->arg_len = 0;
+                        state->cur_value = 0;
+                        break;
+                    case CMD_SPRITE_IMAGE:
+                        switch (state->arg_len) {
+                        case 4:
+                            state->anim->sprite[state->cur_sprite].src_data = (const uint16_t*)((uint8_t*)image_data + (state->cur_value & ~1));
+                            state->cur_value = 0;
+                            break;
+                        case 2:
+                            state->anim->sprite[state->cur_sprite].width = state->cur_value;
+                            state->cur_value = 0;
+                            break;
+                        case 0:
+                            state->anim->sprite[state->cur_sprite].height = state->cur_value;
+                            state->anim->sprite[state->cur_sprite].enable = true;
+                            state->cur_value = 0;
+                            tcp_server_ok(state);
+                            state->cmd = CMD_NONE;
+                            break;
+                        }
+                        break;
+                    case CMD_SPRITE_POS:
+                        switch (state->arg_len) {
+                        case 2:
+                            state->anim->sprite[state->cur_sprite].x = state->cur_value;
+                            state->cur_value = 0;
+                            break;
+                        case 0:
+                            state->anim->sprite[state->cur_sprite].y = state->cur_value;
+                            state->cur_value = 0;
+                            tcp_server_ok(state);
+                            state->cmd = CMD_NONE;
+                            break;
+                        }
+                        break;
+                    case CMD_SPRITE_ATTR:
+                        switch (state->arg_len) {
+                        case 2:
+                            state->anim->sprite[state->cur_sprite].enable = state->cur_value != 0;
+                            state->cur_value = 0;
+                            break;
+                        case 1:
+                            state->anim->sprite[state->cur_sprite].flags = state->cur_value & (SPRITE_FLIP_X | SPRITE_FLIP_Y);
+                            state->cur_value = 0;
+                            break;
+                        case 0:
+                            state->anim->sprite[state->cur_sprite].priority = (state->cur_value > MAX_LAYERS) ? MAX_LAYERS : state->cur_value;
+                            state->cur_value = 0;
+                            tcp_server_ok(state);
+                            state->cmd = CMD_NONE;
+                            break;
+                        }
+                        break;
+                    case CMD_LAYER:
+                        state->cur_layer = (state->cur_value >= MAX_LAYERS) ? MAX_LAYERS - 1 : state->cur_value;
+                        tcp_server_ok(state);
+                        state->cmd = CMD_NONE;
+                        state->arg_len = 0;
+                        state->cur_value = 0;
+                        break;
+                    case CMD_LAYER_SIZE:
+                        switch (state->arg_len) {
+                        case 2:
+                            state->anim->layer[state->cur_layer].box.width = state->cur_value;
+                            state->cur_value = 0;
+                            break;
+                        case 0:
+                            state->anim->layer[state->cur_layer].box.height = state->cur_value;
+                            state->cur_value = 0;
+                            tcp_server_ok(state);
+                            state->cmd = CMD_NONE;
+                            break;
+                        }
+                        break;
+                    case CMD_LAYER_COLOR:
+                        switch (state->arg_len) {
+                        case 2:
+                            state->anim->layer[state->cur_layer].box.fg_color = state->cur_value;
+                            state->cur_value = 0;
+                            break;
+                        case 0:
+                            state->anim->layer[state->cur_layer].box.bg_color = state->cur_value;
+                            state->cur_value = 0;
+                            tcp_server_ok(state);
+                            state->cmd = CMD_NONE;
+                            break;
+                        }
+                        break;
+                    case CMD_BACK_FORMAT:
+                        switch (state->arg_len) {
+                        case 5:
+                            state->arg_index = (state->cur_value >= MAX_ANIM) ? MAX_ANIM - 1 : state->cur_value;
+                            state->cur_value = 0;
+                            break;
+                        case 4:
+                            tcp_server_set_format(state, state->cur_value);
+                            state->cur_value = 0;
+                            break;
+                        case 0:
+                            tcp_server_set_table(state);
+                            state->cur_value = 0;
+                            break;
+                        }
+                        break;
+                    case CMD_LAYER_BLEND:
+                        switch (state->arg_len) {
+                        case 1:
+                            state->anim->layer[state->cur_layer].box.format = (state->cur_value == IMG_FORMAT_ARGB4444) ? IMG_FORMAT_ARGB4444 : IMG_FORMAT_RGB565;
+                            state->cur_value = 0;
+                            break;
+                        case 0:
+                            state->anim->layer[state->cur_layer].box.opacity = state->cur_value;
+                            state->cur_value = 0;
+                            tcp_server_ok(state);
+                            state->cmd = CMD_NONE;
+                            break;
+                        }
                         break;
                     case CMD_BRIGHTNESS:
-                        state->anim.brightness = (state->cur_value >= MAX_BRIGHTNESS) ? MAX_BRIGHTNESS - 1 : state->cur_value;
-                        tcp_server_send_data(arg, state->client_pcb, "[OK]\r\n");
+                        state->anim->brightness = (state->cur_value >= MAX_BRIGHTNESS) ? MAX_BRIGHTNESS - 1 : state->cur_value;
+                        tcp_server_ok(state);
                         state->cmd = CMD_NONE;
                         state->arg_len = 0;
                         state->cur_value = 0;
                         break;
+                    case CMD_DMX:
+                        switch (state->arg_len) {
+                        case 2:
+                            state->dmx_first_universe = state->cur_value;
+                            state->cur_value = 0;
+                            break;
+                        case 1:
+                            state->dmx_universe_pixels = state->cur_value;
+                            state->cur_value = 0;
+                            break;
+                        case 0:
+                            tcp_server_set_dmx(state->server, state->dmx_first_universe, state->dmx_universe_pixels, state->cur_value);
+                            state->cur_value = 0;
+                            tcp_server_ok(state);
+                            state->cmd = CMD_NONE;
+                            break;
+                        }
+                        break;
                     case CMD_OFFSET:
                         switch (state->arg_len) {
                         case 2:
-                            state->anim.backdrop.y = state->cur_value;
+                            state->anim->backdrop.y = state->cur_value;
                             state->cur_value = 0;
                             break;
                         case 0:
-                            state->anim.backdrop.x = state->cur_value;
+                            state->anim->backdrop.x = state->cur_value;
                             state->cur_value = 0;
-                            tcp_server_send_data(arg, state->client_pcb, "[OK]\r\n");
+                            tcp_server_ok(state);
+                            state->cmd = CMD_NONE;
+                            break;
+                        }
+                        break;
+                    case CMD_BIT_DEPTH:
+                        tcp_server_set_depth(state);
+                        state->cur_value = 0;
+                        break;
+                    case CMD_SCAN_MODE:
+                        state->anim->scan_mode = (state->cur_value == SCAN_MODE_SPLIT) ? SCAN_MODE_SPLIT : SCAN_MODE_BCM;
+                        tcp_server_ok(state);
+                        state->cmd = CMD_NONE;
+                        state->arg_len = 0;
+                        state->cur_value = 0;
+                        break;
+                    case CMD_ANIM_TICK:
+                        if (state->arg_len == 0) {
+                            state->anim->anim_tick_ms = state->cur_value;
+                            state->cur_value = 0;
+                            tcp_server_ok(state);
+                            state->cmd = CMD_NONE;
+                        }
+                        break;
+                    case CMD_GAMMA:
+                        switch (state->arg_len) {
+                        case 2:
+                            state->anim->gamma = state->cur_value;
+                            state->cur_value = 0;
+                            break;
+                        case 0:
+                            state->anim->dither = (state->cur_value != 0) ? true : false;
+                            state->cur_value = 0;
+                            tcp_server_ok(state);
                             state->cmd = CMD_NONE;
                             break;
                         }
                         break;
                     case CMD_OVERLAY_ENABLE:
-                        state->anim.overlay_enable = (state->cur_value != 0) ? true : false;
-                        tcp_server_send_data(arg, state->client_pcb, "[OK]\r\n");
+                        state->anim->layer[state->cur_layer].enable = (state->cur_value != 0) ? true : false;
+                        tcp_server_ok(state);
                         state->cmd = CMD_NONE;
                         state->arg_len = 0;
                         state->cur_value = 0;
@@ -406,23 +1180,37 @@ err_t tcp_server_recv(void* arg, struct tcp_pcb* tpcb, struct pbuf* p, err_t err
                     case CMD_DATA_HEADER:
                         switch(state->arg_len) {
                         case 4:
-                            state->img_data = ((uint16_t*)image_data) + state->cur_value;
+                            state->img_data = (state->cur_value < DEF_FRAMEBUFFER_SIZE / 2) ? ((uint16_t*)image_data) + state->cur_value : NULL;
                             state->cur_value = 0;
                             break;
                         case 0:
-                            state->cmd = CMD_DATA;
+                            state->cmd = tcp_server_data_fits(state, state->cur_value) ? CMD_DATA : CMD_DATA_SKIP;
                             state->arg_len = state->cur_value;
                             state->cur_value = 0;
                             break;
                         }
                         break;
+                    case CMD_DATA_SKIP:
+                        if (state->arg_len == 0) {
+                            tcp_server_fail(state, ACK_ERR_DATA_RANGE);
+                            state->cmd = CMD_NONE;
+                        }
+                        break;
+                    case CMD_SEQUENCE:
+                        if (state->arg_len == 0) {
+                            tcp_server_set_seq(state);
+                            state->cur_value = 0;
+                        }
+                        break;
                     case CMD_DATA:
                         if ((state->arg_len & 0x1) == 0) {
+                            if (!state->data_start || state->img_data < state->data_start) state->data_start = state->img_data;
                             *state->img_data = state->cur_value;
                             state->cur_value = 0;
                             state->img_data++;
+                            if (state->img_data > state->data_end) state->data_end = state->img_data;
                             if (state->arg_len == 0) {
-                                tcp_server_send_data(arg, state->client_pcb, "[OK]\r\n");
+                                tcp_server_ok(state);
                                 state->cmd = CMD_NONE;
                             }
                         }
@@ -435,6 +1223,33 @@ err_t tcp_server_recv(void* arg, struct tcp_pcb* tpcb, struct pbuf* p, err_t err
             }
         }
     }
+}
+
+err_t tcp_server_recv(void* arg, struct tcp_pcb* tpcb, struct pbuf* p, err_t err) {
+    TCP_CLIENT_T* state = (TCP_CLIENT_T*)arg;
+    struct pbuf* q;
+    if (!p) {
+        return tcp_server_close(arg);
+    }
+    // this method is callback from lwIP, so cyw43_arch_lwip_begin is not required, however you
+    // can use this method to cause an assertion in debug mode, if this method is called when
+    // cyw43_arch_lwip_begin IS needed
+    cyw43_arch_lwip_check();
+    state->data_start = NULL;
+    state->data_end = NULL;
+    // The data can come in a chain of pbufs
+    for (q = p; q != NULL && state->pcb; q = q->next) {
+        tcp_server_parse(arg, (const char*)q->payload, q->len);
+    }
+    // Redraw the rows showing the uploaded data
+    if (state->data_start) {
+        render_invalidate_data(&state->server->anim, state->data_start, state->data_end);
+    }
+    // A reply failed and closed the connection, the pcb may already be gone
+    if (!state->pcb) {
+        pbuf_free(p);
+        return ERR_ABRT;
+    }
     if (p->tot_len > 0) {
         tcp_recved(tpcb, p->tot_len);
     }
@@ -444,33 +1259,125 @@ err_t tcp_server_recv(void* arg, struct tcp_pcb* tpcb, struct pbuf* p, err_t err
 
 }
 
+// A datagram of a streamed frame, its pixels copied out of the pbufs straight into the frame
+static void tcp_server_stream_recv(void* arg, struct udp_pcb* pcb, struct pbuf* p, const ip_addr_t* addr, u16_t port)
+{
+    TCP_SERVER_T* state = (TCP_SERVER_T*)arg;
+    uint8_t header[STREAM_HEADER_SIZE];
+    uint16_t* dst;
+
+    if (pbuf_copy_partial(p, header, STREAM_HEADER_SIZE, 0) == STREAM_HEADER_SIZE) {
+        dst = stream_begin(&state->stream, header, p->tot_len - STREAM_HEADER_SIZE);
+        if (dst) {
+            pbuf_copy_partial(p, dst, p->tot_len - STREAM_HEADER_SIZE, STREAM_HEADER_SIZE);
+            stream_end(&state->stream);
+        }
+    }
+    pbuf_free(p);
+}
+
+// A DMX packet, on the E1.31 port if sacn is set and on the Art-Net port otherwise
+static void tcp_server_dmx_recv(TCP_SERVER_T* state, struct pbuf* p, bool sacn)
+{
+    static uint8_t packet[DMX_MAX_PACKET];
+    uint16_t len = (p->tot_len > DMX_MAX_PACKET) ? DMX_MAX_PACKET : p->tot_len;
+    const uint8_t* data = pbuf_get_contiguous(p, packet, sizeof(packet), len, 0);
+
+    if (data && sacn) {
+        dmx_sacn(&state->dmx, &state->stream, data, len);
+        // the sync universe is only known from the data packets
+        if (state->dmx.sync_universe != state->sacn_sync_group) {
+            if (state->sacn_sync_group) tcp_server_sacn_group(state->sacn_sync_group, false);
+            state->sacn_sync_group = state->dmx.sync_universe;
+            tcp_server_sacn_group(state->sacn_sync_group, true);
+        }
+    } else if (data) {
+        dmx_artnet(&state->dmx, &state->stream, data, len);
+    }
+    pbuf_free(p);
+}
+
+static void tcp_server_sacn_recv(void* arg, struct udp_pcb* pcb, struct pbuf* p, const ip_addr_t* addr, u16_t port)
+{
+    tcp_server_dmx_recv((TCP_SERVER_T*)arg, p, true);
+}
+
+static void tcp_server_artnet_recv(void* arg, struct udp_pcb* pcb, struct pbuf* p, const ip_addr_t* addr, u16_t port)
+{
+    tcp_server_dmx_recv((TCP_SERVER_T*)arg, p, false);
+}
+
+// UDP receivers are optional, the server works without them if one can't be set up
+static struct udp_pcb* tcp_server_udp_open(TCP_SERVER_T* state, u16_t port, udp_recv_fn recv)
+{
+    struct udp_pcb* pcb = udp_new_ip_type(IPADDR_TYPE_ANY);
+    if (pcb) {
+        if (udp_bind(pcb, NULL, port) == ERR_OK) {
+            udp_recv(pcb, recv, state);
+        } else {
+            udp_remove(pcb);
+            pcb = NULL;
+        }
+    }
+    return pcb;
+}
+
 static err_t tcp_server_poll(void* arg, struct tcp_pcb* tpcb) {
     return ERR_OK;
 }
 
+// lwIP has already freed the pcb, so only the slot is freed
 static void tcp_server_err(void* arg, err_t err) {
-    if (err != ERR_ABRT) {
-        tcp_server_close(arg);
+    TCP_CLIENT_T* state = (TCP_CLIENT_T*)arg;
+    if (state) {
+        state->pcb = NULL;
+        tcp_server_drop(state);
     }
 }
 
 static err_t tcp_server_accept(void* arg, struct tcp_pcb* client_pcb, err_t err) {
-    TCP_SERVER_T* state = (TCP_SERVER_T*)arg;
+    TCP_SERVER_T* server = (TCP_SERVER_T*)arg;
+    TCP_CLIENT_T* state = NULL;
+    uint8_t c;
     if (err != ERR_OK || client_pcb == NULL) {
         return ERR_VAL;
     }
 
-    // Close any prior connection
-    tcp_server_close(arg);
+    // Turn the connection away when every slot is taken
+    for (c = 0; c < MAX_CLIENTS; c++) {
+        if (!server->client[c].pcb) {
+            state = &server->client[c];
+            break;
+        }
+    }
+    if (!state) {
+        tcp_abort(client_pcb);
+        return ERR_ABRT;
+    }
 
-    state->client_pcb = client_pcb;
+    // Edits the last client in the slot left are kept until the frame boundary applies them
+    state->server = server;
+    state->pcb = client_pcb;
+    state->anim = &server->edit;
+    state->ascii_mode = true;
+    state->cmd = CMD_NONE;
+    state->cur_value = 0;
+    state->arg_len = 0;
+    state->img_data = (uint16_t*)image_data;
+    state->cur_layer = 0;
+    state->cur_sprite = 0;
+    state->arg_index = 0;
+    state->pipelined = false;
+    state->ack_pending = false;
+    state->num_errors = 0;
+    state->more_errors = 0;
     tcp_arg(client_pcb, state);
     tcp_sent(client_pcb, tcp_server_sent);
     tcp_recv(client_pcb, tcp_server_recv);
     tcp_poll(client_pcb, tcp_server_poll, POLL_TIME_S * 2);
     tcp_err(client_pcb, tcp_server_err);
 
-    return ERR_OK; // tcp_server_send_data(arg, state->client_pcb, "Ready\r\n");
+    return ERR_OK; // tcp_server_send_data(arg, state->pcb, "Ready\r\n");
 }
 
 bool tcp_server_open(void* arg) {
@@ -487,7 +1394,7 @@ bool tcp_server_open(void* arg) {
         return false;
     }
 
-    state->server_pcb = tcp_listen_with_backlog(pcb, 1);
+    state->server_pcb = tcp_listen_with_backlog(pcb, MAX_CLIENTS);
     if (!state->server_pcb) {
         if (pcb) {
             tcp_close(pcb);
@@ -498,17 +1405,22 @@ bool tcp_server_open(void* arg) {
     tcp_arg(state->server_pcb, state);
     tcp_accept(state->server_pcb, tcp_server_accept);
 
+    // Streamed frames and DMX universes come in over UDP
+    state->stream_pcb = tcp_server_udp_open(state, STREAM_PORT, tcp_server_stream_recv);
+    state->sacn_pcb = tcp_server_udp_open(state, DMX_SACN_PORT, tcp_server_sacn_recv);
+    state->artnet_pcb = tcp_server_udp_open(state, DMX_ARTNET_PORT, tcp_server_artnet_recv);
+    if (state->sacn_pcb) {
+        tcp_server_set_dmx(state, DMX_DEF_FIRST_UNIVERSE, DMX_UNIVERSE_PIXELS, 0);
+    } else {
+        dmx_config(&state->dmx, DMX_DEF_FIRST_UNIVERSE, DMX_UNIVERSE_PIXELS, 0);
+    }
+
     state->server_ok = true;
-    state->img_data = (uint16_t*)image_data;
-    state->cmd = CMD_NONE;
-    state->ascii_mode = true;
+    state->bulk_upload = true;
     state->anim.brightness = 0x8;
     state->anim.backdrop.x = 0;
     state->anim.backdrop.y = 0;
-    state->cur_value = 0;
-    state->arg_len = 0;
-    state->server_ok = true;
-    state->anim.overlay_enable = true;
+    state->anim.layer[0].enable = true;
 
     return true;
 }
@@ -0,0 +1,187 @@
+// Loopback test of the frame stream receiver on the host
+// A thread sends frames over UDP on localhost while the receiver takes them in the way the
+// firmware does, swapping at a simulated refresh rate, and checks that every frame it shows
+// came in whole. Losing a share of the datagrams on purpose exercises dropping frames, and sending
+// the first datagram of a share of the frames again after the frame checks that late repeats are
+// turned away instead of starting the frame over, which without loss would drop it.
+// usage: led-stream-test [seconds] [fps, 0 for as fast as possible] [refresh Hz] [datagrams lost in %]
+//                        [frames repeated in %]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <pthread.h>
+#include <poll.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include "led-stream.h"
+
+#define TEST_PORT (STREAM_PORT + 100)
+
+static STREAM_T test_stream;
+static volatile bool test_done = false;
+static double test_fps;
+static uint32_t test_loss;
+static uint32_t test_repeat;
+static uint32_t test_sent = 0;
+
+static uint64_t test_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+// Every pixel of a frame holds the low byte of its id and its row, so a frame mixing two of them shows up
+static uint16_t test_pixel(uint16_t frame, uint32_t row)
+{
+    return (frame & 0xff) | (row << 8);
+}
+
+static void* test_sender(void* arg)
+{
+    int sock = socket(AF_INET, SOCK_DGRAM, 0);
+    struct sockaddr_in addr;
+    uint16_t pixels[STREAM_MAX_ROWS * LED_PANEL_WIDTH];
+    uint8_t datagram[STREAM_HEADER_SIZE + sizeof(pixels)];
+    uint8_t first[STREAM_HEADER_SIZE + sizeof(pixels)];
+    uint32_t first_len = 0;
+    uint16_t frame = 0;
+    uint32_t row, rows, i, len;
+    uint64_t next_ns = test_ns();
+    struct timespec ts;
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(TEST_PORT);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    while (!test_done) {
+        for (row = 0; row < LED_PANEL_HEIGHT; row += rows) {
+            rows = (LED_PANEL_HEIGHT - row < STREAM_MAX_ROWS) ? LED_PANEL_HEIGHT - row : STREAM_MAX_ROWS;
+            for (i = 0; i < rows * LED_PANEL_WIDTH; i++) {
+                pixels[i] = test_pixel(frame, row + i / LED_PANEL_WIDTH);
+            }
+            len = stream_encode(datagram, frame, row, rows, pixels);
+            if (row == 0) {
+                memcpy(first, datagram, len);
+                first_len = len;
+            }
+            if ((uint32_t)(rand() % 100) < test_loss) continue;
+            sendto(sock, datagram, len, 0, (struct sockaddr*)&addr, sizeof(addr));
+        }
+        if ((uint32_t)(rand() % 100) < test_repeat) {
+            sendto(sock, first, first_len, 0, (struct sockaddr*)&addr, sizeof(addr));
+        }
+        frame++;
+        test_sent++;
+
+        if (test_fps > 0) {
+            next_ns += (uint64_t)(1000000000.0 / test_fps);
+            ts.tv_sec = next_ns / 1000000000ull;
+            ts.tv_nsec = next_ns % 1000000000ull;
+            clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL);
+        } else {
+            // leave the receiver some room on a single core
+            sched_yield();
+        }
+    }
+    close(sock);
+    return NULL;
+}
+
+// A shown frame has to be one frame, all of it
+static bool test_check(const uint32_t* frame)
+{
+    const uint16_t* pixel = (const uint16_t*)frame;
+    uint16_t id = pixel[0] & 0xff;
+    uint32_t r, c;
+
+    for (r = 0; r < LED_PANEL_HEIGHT; r++) {
+        for (c = 0; c < LED_PANEL_WIDTH; c++) {
+            if (pixel[r * LED_PANEL_WIDTH + c] != test_pixel(id, r)) return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    double seconds = (argc > 1) ? strtod(argv[1], NULL) : 5.0;
+    double refresh = (argc > 3) ? strtod(argv[3], NULL) : 120.0;
+    int sock = socket(AF_INET, SOCK_DGRAM, 0);
+    int rcvbuf = 256 * 1024;
+    struct sockaddr_in addr;
+    struct pollfd pfd;
+    uint8_t datagram[2048];
+    uint16_t* dst;
+    const uint32_t* frame;
+    uint64_t start_ns, end_ns, vsync_ns, now_ns;
+    uint32_t torn = 0;
+    uint32_t vsyncs = 0;
+    ssize_t len;
+    pthread_t sender;
+    int timeout;
+
+    test_fps = (argc > 2) ? strtod(argv[2], NULL) : 60.0;
+    test_loss = (argc > 4) ? strtoul(argv[4], NULL, 0) : 0;
+    test_repeat = (argc > 5) ? strtoul(argv[5], NULL, 0) : 0;
+    if (seconds <= 0 || refresh <= 0 || test_loss > 100 || test_repeat > 100) {
+        printf("usage: %s [seconds] [fps, 0 for as fast as possible] [refresh Hz] [datagrams lost in %%] [frames repeated in %%]\n", argv[0]);
+        return 1;
+    }
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(TEST_PORT);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    setsockopt(sock, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+    if (bind(sock, (struct sockaddr*)&addr, sizeof(addr)) != 0) {
+        perror("bind");
+        return 1;
+    }
+
+    stream_init(&test_stream);
+    pthread_create(&sender, NULL, test_sender, NULL);
+    start_ns = test_ns();
+    end_ns = start_ns + (uint64_t)(seconds * 1e9);
+    vsync_ns = start_ns;
+    pfd.fd = sock;
+    pfd.events = POLLIN;
+
+    while ((now_ns = test_ns()) < end_ns) {
+        // the frame boundary, as the main loop of the firmware sees it
+        if (now_ns >= vsync_ns) {
+            frame = stream_swap(&test_stream);
+            if (frame && !test_check(frame)) torn++;
+            vsyncs++;
+            vsync_ns += (uint64_t)(1e9 / refresh);
+            continue;
+        }
+        timeout = (vsync_ns - now_ns + 999999) / 1000000;
+        if (poll(&pfd, 1, timeout) <= 0) continue;
+        len = recv(sock, datagram, sizeof(datagram), 0);
+        if (len < STREAM_HEADER_SIZE) continue;
+        dst = stream_begin(&test_stream, datagram, len - STREAM_HEADER_SIZE);
+        if (dst) {
+            memcpy(dst, datagram + STREAM_HEADER_SIZE, len - STREAM_HEADER_SIZE);
+            stream_end(&test_stream);
+        }
+    }
+    test_done = true;
+    pthread_join(sender, NULL);
+
+    seconds = (test_ns() - start_ns) / 1e9;
+    printf("sent      %8lu frames  %7.1f fps\n", (unsigned long)test_sent, test_sent / seconds);
+    printf("received  %8lu frames  %7.1f fps  %lu datagrams\n", (unsigned long)test_stream.stats.frames,
+        test_stream.stats.frames / seconds, (unsigned long)test_stream.stats.datagrams);
+    printf("shown     %8lu frames  %7.1f fps  of %lu refreshes\n", (unsigned long)test_stream.stats.shown,
+        test_stream.stats.shown / seconds, (unsigned long)vsyncs);
+    printf("dropped   %8lu frames, incomplete\n", (unsigned long)test_stream.stats.dropped);
+    printf("replaced  %8lu frames, by a newer one before the refresh\n", (unsigned long)test_stream.stats.replaced);
+    printf("errors    %8lu datagrams\n", (unsigned long)test_stream.stats.errors);
+    printf("torn      %8lu frames\n", (unsigned long)torn);
+    // without loss, only repeats turned away too late could drop a frame
+    return (torn || (!test_loss && test_stream.stats.dropped)) ? 1 : 0;
+}
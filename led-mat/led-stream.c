@@ -0,0 +1,124 @@
+// Frame streaming over UDP
+// The network side hands over a datagram in two steps: stream_begin parses the header and says
+// where the pixels go, so they can be copied straight out of the network buffers, and
+// stream_end accounts for them once they are there
+
+#include "led-stream.h"
+
+void stream_init(STREAM_T* stream)
+{
+    memset(stream, 0, sizeof(STREAM_T));
+    stream->front = 0;
+    stream->back = 1;
+    stream->idle_frames = STREAM_IDLE_FRAMES;
+}
+
+static void stream_start_frame(STREAM_T* stream, uint16_t frame)
+{
+    if (stream->receiving && stream->num_rows < LED_PANEL_HEIGHT) stream->stats.dropped++;
+    stream->receiving = true;
+    stream->frame = frame;
+    stream->num_rows = 0;
+    memset(stream->row_done, 0, sizeof(stream->row_done));
+}
+
+// Returns where the len bytes of pixels after the header go, NULL to skip the datagram
+uint16_t* stream_begin(STREAM_T* stream, const uint8_t* header, uint32_t len)
+{
+    uint16_t rows = header[1];
+    uint16_t frame = header[2] | (header[3] << 8);
+    uint16_t row = header[4] | (header[5] << 8);
+
+    stream->dst = NULL;
+    stream->stats.datagrams++;
+    if (header[0] != STREAM_MAGIC || rows == 0 || row + rows > LED_PANEL_HEIGHT ||
+        len != (uint32_t)rows * LED_PANEL_WIDTH * 2) {
+        stream->stats.errors++;
+        return NULL;
+    }
+
+    // a newer frame gives up on the one being received, anything older is late, and so is
+    // anything up to the last complete frame, which would otherwise start it over
+    if (!stream->receiving || frame != stream->frame) {
+        if ((stream->receiving && (int16_t)(frame - stream->frame) < 0) ||
+            (stream->last_valid && (int16_t)(frame - stream->last_frame) <= 0)) {
+            stream->stats.errors++;
+            return NULL;
+        }
+        stream_start_frame(stream, frame);
+    }
+
+    stream->dst = (uint16_t*)stream->buffer[stream->back] + row * LED_PANEL_WIDTH;
+    stream->dst_row = row;
+    stream->dst_rows = rows;
+    return stream->dst;
+}
+
+void stream_end(STREAM_T* stream)
+{
+    uint16_t r;
+
+    if (!stream->dst) return;
+    stream->dst = NULL;
+    for (r = stream->dst_row; r < stream->dst_row + stream->dst_rows; r++) {
+        if (!stream->row_done[r]) {
+            stream->row_done[r] = true;
+            stream->num_rows++;
+        }
+    }
+    if (stream->num_rows < LED_PANEL_HEIGHT) return;
+    stream->last_frame = stream->frame;
+    stream->last_valid = true;
+    stream_complete(stream);
+}
+
+// The back buffer holds a complete frame, so it becomes the front one and the next frame goes
+// into the one it replaces
+void stream_complete(STREAM_T* stream)
+{
+    stream->stats.frames++;
+    if (stream->fresh) stream->stats.replaced++;
+    stream->fresh = true;
+    stream->front = stream->back;
+    stream->back = 1 - stream->front;
+    stream->receiving = false;
+}
+
+// At the frame boundary, returns the newest complete frame if there is one since the last call
+// It may be in the same buffer as the one returned before, so the caller redraws all of it
+const uint32_t* stream_swap(STREAM_T* stream)
+{
+    if (!stream->fresh) {
+        if (stream->idle_frames < STREAM_IDLE_FRAMES) stream->idle_frames++;
+        if (stream->idle_frames == STREAM_IDLE_FRAMES) stream->last_valid = false;
+        return NULL;
+    }
+    stream->fresh = false;
+    stream->idle_frames = 0;
+    stream->stats.shown++;
+    return stream->buffer[stream->front];
+}
+
+// Frames are coming in, so the backdrop belongs to the stream
+bool stream_active(const STREAM_T* stream)
+{
+    return stream->idle_frames < STREAM_IDLE_FRAMES;
+}
+
+// Builds a datagram for rows of a frame, returns its size
+uint32_t stream_encode(uint8_t* dst, uint16_t frame, uint16_t row, uint16_t rows, const uint16_t* pixels)
+{
+    uint32_t i;
+
+    dst[0] = STREAM_MAGIC;
+    dst[1] = rows;
+    dst[2] = frame & 0xff;
+    dst[3] = frame >> 8;
+    dst[4] = row & 0xff;
+    dst[5] = row >> 8;
+    for (i = 0; i < (uint32_t)rows * LED_PANEL_WIDTH; i++) {
+        dst[STREAM_HEADER_SIZE + 2 * i] = pixels[i] & 0xff;
+        dst[STREAM_HEADER_SIZE + 2 * i + 1] = pixels[i] >> 8;
+    }
+    return STREAM_HEADER_SIZE + 2 * i;
+}
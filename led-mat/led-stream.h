@@ -0,0 +1,71 @@
+//
+// LED Matrix frame streaming
+// Receives whole RGB565 frames as UDP datagrams for live video, without going through the
+// command parser, and shows each one at the frame boundary once all of its rows are in
+// Without any Pico SDK dependency, so senders and test harnesses on the host share it
+//
+
+#ifndef __LED_STREAM_H
+#define __LED_STREAM_H
+
+#include "led-render.h"
+
+#define STREAM_PORT 4243
+
+// Each datagram is a 6 byte header followed by rows * LED_PANEL_WIDTH pixels, RGB565 little endian
+//  0     STREAM_MAGIC
+//  1     number of rows
+//  2-3   frame id, little endian, counting up
+//  4-5   first row, little endian
+#define STREAM_HEADER_SIZE 6
+static const uint8_t STREAM_MAGIC = 'V';
+
+// Rows per datagram that keep it from being fragmented on a 1500 byte MTU
+#define STREAM_MAX_ROWS ((1472 - STREAM_HEADER_SIZE) / (LED_PANEL_WIDTH * 2))
+
+// Frames are received into the back buffer, and the front one holds the last complete frame
+// They swap as soon as a frame is complete; the front buffer is only read when a frame is
+// composed, at the frame boundary, so a frame still shows whole and from the next boundary on
+#define STREAM_NUM_BUFFERS 2
+#define STREAM_FRAME_WORDS (LED_PANEL_WIDTH * LED_PANEL_HEIGHT / 2)
+
+// Frame boundaries without a new frame before the stream lets go of the backdrop
+static const uint32_t STREAM_IDLE_FRAMES = 120;
+
+typedef struct STREAM_STATS_T_ {
+    uint32_t datagrams;
+    uint32_t frames;  // complete frames received
+    uint32_t shown;  // complete frames swapped in
+    uint32_t dropped;  // frames given up on before all their rows came in
+    uint32_t replaced;  // complete frames overtaken by a newer one before being shown
+    uint32_t errors;  // datagrams that were malformed, stale or repeated
+} STREAM_STATS_T;
+
+typedef struct STREAM_T_ {
+    uint32_t buffer[STREAM_NUM_BUFFERS][STREAM_FRAME_WORDS];
+    uint8_t front;  // the last complete frame
+    uint8_t back;  // being received
+    bool fresh;  // front completed since the last frame boundary
+    bool receiving;  // back holds part of a frame
+    uint16_t frame;  // id of the frame in back
+    uint16_t last_frame;  // id of the last complete frame, nothing up to it is taken again
+    bool last_valid;  // cleared when the stream goes idle, for senders that start over
+    uint16_t num_rows;  // rows of it received
+    bool row_done[LED_PANEL_HEIGHT];
+    uint32_t idle_frames;
+    uint16_t* dst;  // where the pixels of the datagram being received go
+    uint16_t dst_rows;
+    uint16_t dst_row;
+    STREAM_STATS_T stats;
+} STREAM_T;
+
+// Stream functions
+void stream_init(STREAM_T* stream);
+uint16_t* stream_begin(STREAM_T* stream, const uint8_t* header, uint32_t len);
+void stream_end(STREAM_T* stream);
+void stream_complete(STREAM_T* stream);
+const uint32_t* stream_swap(STREAM_T* stream);
+bool stream_active(const STREAM_T* stream);
+uint32_t stream_encode(uint8_t* dst, uint16_t frame, uint16_t row, uint16_t rows, const uint16_t* pixels);
+
+#endif  // __LED_STREAM_H
@@ -0,0 +1,253 @@
+// Benchmark of binary image data uploads through the tcp server on the host
+// Records uploads the way they arrive, a command stream cut into segments that are chained into
+// pbufs, and feeds them to the server's tcp_server_recv, parsing them a byte at a time as it used
+// to and with the bulk copy it does now. Some uploads don't fit in image data and are passed over,
+// and the segments split pixels, so every path of the parser is taken. The image data written is
+// checked against the recording, and so are the replies.
+// The server builds against the stand-ins in host/ for the SDK and lwIP, with lwIP's side of a
+// single connection here.
+// usage: led-upload-bench [megabytes] [segment size, 0 for random]
+
+#include <time.h>
+#include "led-mat.h"
+
+#define BENCH_UPLOAD_SIZE (LED_PANEL_WIDTH * LED_PANEL_HEIGHT * 2)
+#define BENCH_MAX_SEGMENT 1460
+// Segments lwIP hands over in one call at most, when they queued up
+#define BENCH_MAX_CHAIN 4
+
+uint32_t image_data[DEF_FRAMEBUFFER_SIZE / 4];
+static uint32_t bench_expected[DEF_FRAMEBUFFER_SIZE / 4];
+static uint32_t bench_before[DEF_FRAMEBUFFER_SIZE / 4];
+
+static TCP_SERVER_T bench_server;
+static struct tcp_pcb bench_listen_pcb;
+static struct tcp_pcb bench_client_pcb;
+static uint32_t bench_ok;
+static uint32_t bench_err;
+
+struct tcp_pcb* tcp_new_ip_type(u8_t type)
+{
+    return &bench_listen_pcb;
+}
+
+err_t tcp_bind(struct tcp_pcb* pcb, const ip_addr_t* ipaddr, u16_t port)
+{
+    return ERR_OK;
+}
+
+struct tcp_pcb* tcp_listen_with_backlog(struct tcp_pcb* pcb, u8_t backlog)
+{
+    return pcb;
+}
+
+void tcp_arg(struct tcp_pcb* pcb, void* arg)
+{
+    pcb->arg = arg;
+}
+
+void tcp_accept(struct tcp_pcb* pcb, err_t (*accept)(void* arg, struct tcp_pcb* newpcb, err_t err))
+{
+    pcb->accept = accept;
+}
+
+void tcp_recv(struct tcp_pcb* pcb, err_t (*recv)(void* arg, struct tcp_pcb* tpcb, struct pbuf* p, err_t err))
+{
+    pcb->recv = recv;
+}
+
+// Replies are only counted
+err_t tcp_write(struct tcp_pcb* pcb, const void* dataptr, u16_t len, u8_t apiflags)
+{
+    if (len >= 4 && memcmp(dataptr, "[OK]", 4) == 0) bench_ok++;
+    if (len >= 4 && memcmp(dataptr, "[ERR", 4) == 0) bench_err++;
+    return ERR_OK;
+}
+
+err_t tcp_close(struct tcp_pcb* pcb)
+{
+    pcb->recv = NULL;
+    return ERR_OK;
+}
+
+void tcp_abort(struct tcp_pcb* pcb)
+{
+    pcb->recv = NULL;
+}
+
+// The recording is fed again in the next run
+u8_t pbuf_free(struct pbuf* p)
+{
+    return 1;
+}
+
+void flash_get_unique_id(uint8_t* id)
+{
+    memset(id, 0, FLASH_UNIQUE_ID_SIZE_BYTES);
+}
+
+void flash_save() {}
+void flash_load() {}
+void flash_set_valid(bool valid) {}
+
+uint8_t scan_select_bpc(uint8_t bpc)
+{
+    return bpc;
+}
+
+uint32_t scan_refresh_dhz(uint8_t bpc)
+{
+    return 0;
+}
+
+static uint64_t bench_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+// Switches to binary mode, then uploads a frame at a time to offsets all over image data, with a
+// pixel count that's sometimes odd and now and then running past its end
+// Writes the image data the uploads that fit leave in bench_expected, and counts the replies
+static uint32_t bench_record(uint8_t* stream, uint32_t size, uint32_t* ok, uint32_t* err)
+{
+    uint16_t* expected = (uint16_t*)bench_expected;
+    uint32_t len = 0;
+    uint32_t offset, bytes, i;
+    uint8_t* data;
+
+    memset(bench_expected, 0, sizeof(bench_expected));
+    stream[len++] = '@';
+    stream[len++] = 'b';
+    *ok = 1;
+    *err = 0;
+    while (len + 10 + BENCH_UPLOAD_SIZE <= size) {
+        offset = rand() % ((DEF_FRAMEBUFFER_SIZE - BENCH_UPLOAD_SIZE / 2) / 2);
+        bytes = BENCH_UPLOAD_SIZE - 2 * (rand() & 1);
+        stream[len++] = '@';
+        stream[len++] = 'D';
+        for (i = 0; i < 4; i++) stream[len++] = offset >> (24 - 8 * i);
+        for (i = 0; i < 4; i++) stream[len++] = bytes >> (24 - 8 * i);
+        data = stream + len;
+        for (i = 0; i < bytes; i++) stream[len++] = rand();
+        if (2 * offset + bytes > DEF_FRAMEBUFFER_SIZE) {
+            (*err)++;
+            continue;
+        }
+        for (i = 0; i < bytes / 2; i++) {
+            expected[offset + i] = (data[2 * i] << 8) | data[2 * i + 1];
+        }
+        (*ok)++;
+    }
+    return len;
+}
+
+// Cuts the stream into segments, each payload 2 bytes into a word as lwIP's are, and chains a few
+// of them at a time into the pbufs of a call
+static uint32_t bench_segment(struct pbuf** chain, struct pbuf* segment, uint8_t* copy, const uint8_t* stream,
+    uint32_t len, uint32_t seg_size)
+{
+    uint32_t num_chains = 0;
+    uint32_t pos = 0;
+    uint32_t size, n, s;
+
+    while (pos < len) {
+        n = 1 + rand() % BENCH_MAX_CHAIN;
+        chain[num_chains++] = segment;
+        for (s = 0; s < n && pos < len; s++) {
+            size = seg_size ? seg_size : 1 + rand() % BENCH_MAX_SEGMENT;
+            if (size > len - pos) size = len - pos;
+            copy += (2 - (uintptr_t)copy) & 3;
+            memcpy(copy, stream + pos, size);
+            segment[s].payload = copy;
+            segment[s].len = size;
+            segment[s].next = NULL;
+            if (s > 0) segment[s - 1].next = &segment[s];
+            copy += size;
+            pos += size;
+        }
+        for (size = 0; s > 0; s--) {
+            size += segment[s - 1].len;
+            segment[s - 1].tot_len = size;
+        }
+        segment += n;
+    }
+    return num_chains;
+}
+
+// Opens the server, connects to it and feeds the chains to it
+static double bench_run(bool bulk, struct pbuf** chain, uint32_t num_chains, uint32_t len)
+{
+    uint64_t start;
+    uint32_t c;
+
+    memset(&bench_server, 0, sizeof(bench_server));
+    memset(image_data, 0, sizeof(image_data));
+    bench_ok = 0;
+    bench_err = 0;
+    tcp_server_open(&bench_server);
+    bench_server.bulk_upload = bulk;
+    // the backdrop at the start of image data as at boot, so uploads to it redraw rows
+    bench_server.anim.backdrop.src_data = image_data;
+    bench_server.anim.backdrop.width = LED_PANEL_WIDTH;
+    bench_server.anim.backdrop.pitch = LED_PANEL_WIDTH / 2;
+    bench_server.anim.backdrop.height = LED_PANEL_HEIGHT;
+    bench_listen_pcb.accept(bench_listen_pcb.arg, &bench_client_pcb, ERR_OK);
+    start = bench_ns();
+    for (c = 0; c < num_chains; c++) {
+        bench_client_pcb.recv(bench_client_pcb.arg, &bench_client_pcb, chain[c], ERR_OK);
+    }
+    return len / ((bench_ns() - start) / 1e9) / 1e6;
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t size = ((argc > 1) ? strtoul(argv[1], NULL, 0) : 16) * 1000000;
+    uint32_t seg_sizes[] = { 768, 1460, 0 };
+    uint32_t num_sizes = 3;
+    uint8_t* stream;
+    uint8_t* copy;
+    struct pbuf* segment;
+    struct pbuf** chain;
+    uint32_t len, num_chains, n, ok, err, ok_before, err_before;
+    double before, after;
+
+    if (argc > 2) {
+        seg_sizes[0] = strtoul(argv[2], NULL, 0);
+        num_sizes = 1;
+    }
+    if (size == 0 || seg_sizes[0] > BENCH_MAX_SEGMENT) {
+        printf("usage: %s [megabytes] [segment size up to %d, 0 for random]\n", argv[0], BENCH_MAX_SEGMENT);
+        return 1;
+    }
+    stream = malloc(size);
+    copy = malloc(4 * size + 16);
+    segment = malloc((size + BENCH_MAX_CHAIN) * sizeof(struct pbuf));
+    chain = malloc(size * sizeof(struct pbuf*));
+    len = bench_record(stream, size, &ok, &err);
+
+    printf("segment   before MB/s   after MB/s\n");
+    for (n = 0; n < num_sizes; n++) {
+        num_chains = bench_segment(chain, segment, copy, stream, len, seg_sizes[n]);
+        before = bench_run(false, chain, num_chains, len);
+        memcpy(bench_before, image_data, sizeof(bench_before));
+        ok_before = bench_ok;
+        err_before = bench_err;
+        after = bench_run(true, chain, num_chains, len);
+        if (memcmp(bench_before, bench_expected, sizeof(bench_expected)) != 0 || ok_before != ok || err_before != err) {
+            printf("parsing a byte at a time wrote different image data or replies\n");
+            return 1;
+        }
+        if (memcmp(image_data, bench_expected, sizeof(bench_expected)) != 0 || bench_ok != ok || bench_err != err) {
+            printf("the bulk copy wrote different image data or replies\n");
+            return 1;
+        }
+        if (seg_sizes[n]) {
+            printf("%7lu   %11.1f  %11.1f\n", (unsigned long)seg_sizes[n], before, after);
+        } else {
+            printf(" random   %11.1f  %11.1f\n", before, after);
+        }
+    }
+    return 0;
+}
@@ -38,6 +38,9 @@
 #define LWIP_IPV4                   1
 #define LWIP_TCP                    1
 #define LWIP_UDP                    1
+#define LWIP_IGMP                   1
+// E1.31 multicast groups, one for each universe mapped and the sync universe, besides all systems
+#define MEMP_NUM_IGMP_GROUP         68
 #define LWIP_DNS                    1
 #define LWIP_TCP_KEEPALIVE          1
 #define LWIP_NETIF_TX_SINGLE_PBUF   1